@@ -0,0 +1,44 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GABench.h
+
+ DESCRIPTION:
+  Shared helpers for the GAlib benchmarks.  The objective functions are cheap
+on purpose so that the benchmarks measure the library rather than the problem.
+  Every benchmark seeds the random number generator with the same value so
+that repeated runs of the suite see the same genomes.
+---------------------------------------------------------------------------- */
+#ifndef _ga_bench_h_
+#define _ga_bench_h_
+
+#include <GA1DBinStrGenome.h>
+#include <GAPopulation.h>
+#include <garandom.h>
+
+constexpr unsigned int gaBenchSeed = 20110527;
+
+// Count the bits that are set.
+inline float GABenchOnesObjective(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+// Build an initialized and evaluated population of bit strings.  The caller
+// owns the population.
+inline GAPopulation *GABenchPopulation(int psize, int length)
+{
+	GAResetRNG(gaBenchSeed);
+	GA1DBinaryStringGenome genome(length, GABenchOnesObjective);
+	auto *pop = new GAPopulation(genome, psize);
+	pop->initialize();
+	pop->evaluate(true);
+	return pop;
+}
+
+#endif
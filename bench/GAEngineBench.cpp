@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "GABench.h"
+
+#include <GADCrowdingGA.h>
+#include <GADemeGA.h>
+#include <GAIncGA.h>
+#include <GASStateGA.h>
+#include <GASimpleGA.h>
+#include <GAStaticGA.hpp>
+
+// Time whole generations of an engine on the ones-counting problem.  The
+// first argument is the population size, the second the genome length.  The
+// number of evaluations per second is reported as well since the engines do
+// very different amounts of work per generation.
+template <class GA> static void BM_Generation(benchmark::State &state)
+{
+	GAResetRNG(gaBenchSeed);
+	GA1DBinaryStringGenome genome(state.range(1), GABenchOnesObjective);
+	GA ga(genome);
+	ga.populationSize(state.range(0));
+	ga.pMutation(0.01);
+	ga.pCrossover(0.9);
+	ga.initialize(gaBenchSeed);
+	unsigned long int nevals = ga.statistics().indEvals();
+	for (auto _ : state)
+	{
+		ga.step();
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["evals"] = benchmark::Counter(
+		ga.statistics().indEvals() - nevals, benchmark::Counter::kIsRate);
+}
+
+// The ones-counting objective as a static policy (no DYN_CAST).
+class GABenchOnes
+{
+  public:
+	static float evaluate(GA1DBinaryStringGenome &g)
+	{
+		float score = 0.0;
+		for (int i = 0; i < g.length(); i++)
+		{
+			score += g.gene(i);
+		}
+		return score;
+	}
+};
+
+// The statically dispatched engine with the library operators and selector
+// (this does the same work as GASimpleGA), and with static policies only.
+using GABenchStaticLibraryGA = GAStaticGA<
+	GA1DBinaryStringGenome, GAStaticObjectiveFunction<GABenchOnesObjective>,
+	GAStaticSexualCrossover<GA1DBinaryStringGenome::OnePointCrossover>,
+	GAStaticMutatorFunction<GA1DBinaryStringGenome::FlipMutator>>;
+using GABenchStaticGA =
+	GAStaticGA<GA1DBinaryStringGenome, GABenchOnes,
+			   GAStaticOnePointCrossover<GA1DBinaryStringGenome>,
+			   GAStaticFlipMutator<GA1DBinaryStringGenome>,
+			   GAStaticTournamentSelector>;
+
+// Population sizes and genome lengths for the engine benchmarks.
+#define GA_BENCH_ENGINE ArgsProduct({{30, 100, 300}, {32, 256}})
+
+BENCHMARK_TEMPLATE(BM_Generation, GASimpleGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GASteadyStateGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GAIncrementalGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GADCrowdingGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GADemeGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GABenchStaticLibraryGA)->GA_BENCH_ENGINE;
+BENCHMARK_TEMPLATE(BM_Generation, GABenchStaticGA)->GA_BENCH_ENGINE;
@@ -0,0 +1,368 @@
+#include <benchmark/benchmark.h>
+
+#include "GABench.h"
+
+#include <GA1DArrayGenome.hpp>
+#include <GAArrayListGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GA2DArrayGenome.hpp>
+#include <GA2DBinStrGenome.h>
+#include <GA3DBinStrGenome.h>
+#include <GAFlatTreeGenome.hpp>
+#include <GAListGenome.hpp>
+#include <GATreeGenome.hpp>
+
+// The real genome specializations must be instantiated in exactly one place.
+#define INSTANTIATE_REAL_GENOME
+#include <GARealGenome.h>
+
+#include <cmath>
+#include <memory>
+
+// Each genome family is driven through a factory that builds an initialized
+// genome with (about) n genes.  The operators are then timed on genomes made
+// by the factory so that every family is measured the same way.
+using GABenchFactory = GAGenome *(*)(int);
+
+static int side2(int n) { return std::max(1, STA_CAST(int, std::lround(std::sqrt(n)))); }
+static int side3(int n) { return std::max(1, STA_CAST(int, std::lround(std::cbrt(n)))); }
+
+static GAGenome *make1DBinStr(int n)
+{
+	auto *g = new GA1DBinaryStringGenome(n);
+	g->initialize();
+	return g;
+}
+
+static GAGenome *make2DBinStr(int n)
+{
+	auto *g = new GA2DBinaryStringGenome(side2(n), side2(n));
+	g->initialize();
+	return g;
+}
+
+static GAGenome *make3DBinStr(int n)
+{
+	auto *g = new GA3DBinaryStringGenome(side3(n), side3(n), side3(n));
+	g->initialize();
+	return g;
+}
+
+// The order-based crossovers need a permutation, so the 1D array is filled
+// with a shuffled sequence rather than random values.
+static GAGenome *make1DArray(int n)
+{
+	auto *g = new GA1DArrayGenome<int>(n);
+	for (int i = 0; i < n; i++)
+	{
+		g->gene(i, i);
+	}
+	for (int i = n - 1; i > 0; i--)
+	{
+		g->swap(i, GARandomInt(0, i));
+	}
+	return g;
+}
+
+// The same permutation in doubles.  The permutation crossovers look integers
+// up in a position table but have to search for anything else, so this times
+// the search (slow enough that we keep it to the shorter lengths).
+static GAGenome *make1DArraySearch(int n)
+{
+	std::unique_ptr<GAGenome> tour(make1DArray(n));
+	auto &g = DYN_CAST(GA1DArrayGenome<int> &, *tour);
+	auto *d = new GA1DArrayGenome<double>(n);
+	for (int i = 0; i < n; i++)
+	{
+		d->gene(i, g.gene(i));
+	}
+	return d;
+}
+
+static GAGenome *make2DArray(int n)
+{
+	auto *g = new GA2DArrayGenome<int>(side2(n), side2(n));
+	for (int i = 0; i < g->width(); i++)
+	{
+		for (int j = 0; j < g->height(); j++)
+		{
+			g->gene(i, j, GARandomInt(0, 100));
+		}
+	}
+	return g;
+}
+
+static GAGenome *makeReal(int n)
+{
+	auto *g = new GARealGenome(n, GARealAlleleSet(0.0, 1.0));
+	g->initialize();
+	return g;
+}
+
+// A random tour of the towns 0..n-1.
+template <class ListGenome> static GAGenome *makeTour(int n)
+{
+	auto *g = new ListGenome;
+	std::vector<int> towns(n);
+	for (int i = 0; i < n; i++)
+	{
+		towns[i] = i;
+	}
+	for (int i = n - 1; i > 0; i--)
+	{
+		std::swap(towns[i], towns[GARandomInt(0, i)]);
+	}
+	g->insert(towns[0], GAListBASE::HEAD);
+	for (int i = 1; i < n; i++)
+	{
+		g->insert(towns[i]);
+	}
+	return g;
+}
+
+static GAGenome *makeList(int n) { return makeTour<GAListGenome<int>>(n); }
+static GAGenome *makeArrayList(int n) { return makeTour<GAArrayListGenome<int>>(n); }
+
+// A random tree: each new node goes below or after a randomly chosen node
+// (node 0 is the root, which cannot have siblings).
+static GAGenome *makeTree(int n)
+{
+	auto *g = new GATreeGenome<int>;
+	g->insert(0, GATreeBASE::ROOT);
+	for (int i = 1; i < n; i++)
+	{
+		int k = GARandomInt(0, g->size() - 1);
+		g->warp(k);
+		if (k == 0 || GARandomBit())
+		{
+			g->insert(i, GATreeBASE::BELOW);
+		}
+		else
+		{
+			g->insert(i, GATreeBASE::AFTER);
+		}
+	}
+	return g;
+}
+
+// The same random trees, stored flat.
+static GAGenome *makeFlatTree(int n)
+{
+	std::unique_ptr<GAGenome> tree(makeTree(n));
+	auto *g = new GAFlatTreeGenome<int>;
+	g->GAFlatTree<int>::copy(DYN_CAST(GATreeGenome<int> &, *tree));
+	return g;
+}
+
+/* ----------------------------------------------------------------------------
+   Generic drivers
+---------------------------------------------------------------------------- */
+// Copying is the baseline for the mutators (which work on a fresh copy each
+// iteration so that destructive mutators do not shrink the genome away).
+static void BM_Copy(benchmark::State &state, GABenchFactory make)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> orig(make(state.range(0)));
+	std::unique_ptr<GAGenome> work(orig->clone());
+	for (auto _ : state)
+	{
+		work->copy(*orig);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Mutator(benchmark::State &state, GABenchFactory make, GAGenome::Mutator op)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> orig(make(state.range(0)));
+	std::unique_ptr<GAGenome> work(orig->clone());
+	for (auto _ : state)
+	{
+		work->copy(*orig);
+		benchmark::DoNotOptimize((*op)(*work, 0.01));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Crossover(benchmark::State &state, GABenchFactory make, GAGenome::SexualCrossover op)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> mom(make(state.range(0)));
+	std::unique_ptr<GAGenome> dad(make(state.range(0)));
+	std::unique_ptr<GAGenome> sis(mom->clone());
+	std::unique_ptr<GAGenome> bro(dad->clone());
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize((*op)(*mom, *dad, sis.get(), bro.get()));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+// The same operators without the checks on the genome type, as the genetic
+// algorithms call them once they have resolved the operator tables.
+static void BM_UncheckedMutator(benchmark::State &state, GABenchFactory make, GAGenome::Mutator op)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> orig(make(state.range(0)));
+	std::unique_ptr<GAGenome> work(orig->clone());
+	GAGenome::Mutator f = orig->uncheckedMutator(op);
+	if (f == nullptr)
+	{
+		state.SkipWithError("no unchecked version of the mutator");
+		return;
+	}
+	for (auto _ : state)
+	{
+		work->copy(*orig);
+		benchmark::DoNotOptimize((*f)(*work, 0.01));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_UncheckedCrossover(benchmark::State &state, GABenchFactory make, GAGenome::SexualCrossover op)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> mom(make(state.range(0)));
+	std::unique_ptr<GAGenome> dad(make(state.range(0)));
+	std::unique_ptr<GAGenome> sis(mom->clone());
+	std::unique_ptr<GAGenome> bro(dad->clone());
+	GAGenome::SexualCrossover f = mom->uncheckedCrossover(op);
+	if (f == nullptr)
+	{
+		state.SkipWithError("no unchecked version of the crossover");
+		return;
+	}
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize((*f)(*mom, *dad, sis.get(), bro.get()));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Comparator(benchmark::State &state, GABenchFactory make, GAGenome::Comparator op)
+{
+	GAResetRNG(gaBenchSeed);
+	std::unique_ptr<GAGenome> a(make(state.range(0)));
+	std::unique_ptr<GAGenome> b(make(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize((*op)(*a, *b));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+// Genome lengths (number of genes) for the operator benchmarks.
+#define GA_BENCH_LENGTHS RangeMultiplier(4)->Range(64, 4096)
+// The list and tree operators are much slower, so keep them shorter.
+#define GA_BENCH_NODES RangeMultiplier(4)->Range(16, 1024)
+
+/* ----------------------------------------------------------------------------
+   Binary strings
+---------------------------------------------------------------------------- */
+BENCHMARK_CAPTURE(BM_Copy, 1DBinStr, make1DBinStr)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, 1DBinStr_Flip, make1DBinStr, GA1DBinaryStringGenome::FlipMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DBinStr_Uniform, make1DBinStr, GA1DBinaryStringGenome::UniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DBinStr_EvenOdd, make1DBinStr, GA1DBinaryStringGenome::EvenOddCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DBinStr_OnePoint, make1DBinStr, GA1DBinaryStringGenome::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DBinStr_TwoPoint, make1DBinStr, GA1DBinaryStringGenome::TwoPointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, 1DBinStr_Bit, make1DBinStr, GA1DBinaryStringGenome::BitComparator)->GA_BENCH_LENGTHS;
+
+BENCHMARK_CAPTURE(BM_Copy, 2DBinStr, make2DBinStr)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, 2DBinStr_Flip, make2DBinStr, GA2DBinaryStringGenome::FlipMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DBinStr_Uniform, make2DBinStr, GA2DBinaryStringGenome::UniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DBinStr_EvenOdd, make2DBinStr, GA2DBinaryStringGenome::EvenOddCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DBinStr_OnePoint, make2DBinStr, GA2DBinaryStringGenome::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, 2DBinStr_Bit, make2DBinStr, GA2DBinaryStringGenome::BitComparator)->GA_BENCH_LENGTHS;
+
+BENCHMARK_CAPTURE(BM_Copy, 3DBinStr, make3DBinStr)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, 3DBinStr_Flip, make3DBinStr, GA3DBinaryStringGenome::FlipMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 3DBinStr_Uniform, make3DBinStr, GA3DBinaryStringGenome::UniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 3DBinStr_EvenOdd, make3DBinStr, GA3DBinaryStringGenome::EvenOddCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 3DBinStr_OnePoint, make3DBinStr, GA3DBinaryStringGenome::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, 3DBinStr_Bit, make3DBinStr, GA3DBinaryStringGenome::BitComparator)->GA_BENCH_LENGTHS;
+
+/* ----------------------------------------------------------------------------
+   Arrays
+---------------------------------------------------------------------------- */
+BENCHMARK_CAPTURE(BM_Copy, 1DArray, make1DArray)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, 1DArray_Swap, make1DArray, GA1DArrayGenome<int>::SwapMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_Uniform, make1DArray, GA1DArrayGenome<int>::UniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_EvenOdd, make1DArray, GA1DArrayGenome<int>::EvenOddCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_OnePoint, make1DArray, GA1DArrayGenome<int>::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_TwoPoint, make1DArray, GA1DArrayGenome<int>::TwoPointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_PartialMatch, make1DArray, GA1DArrayGenome<int>::PartialMatchCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_Order, make1DArray, GA1DArrayGenome<int>::OrderCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_Cycle, make1DArray, GA1DArrayGenome<int>::CycleCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_PartialMatch_Search, make1DArraySearch, GA1DArrayGenome<double>::PartialMatchCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_Order_Search, make1DArraySearch, GA1DArrayGenome<double>::OrderCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_Cycle_Search, make1DArraySearch, GA1DArrayGenome<double>::CycleCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, 1DArray_Element, make1DArray, GA1DArrayGenome<int>::ElementComparator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 1DArray_EdgeRecombination, make1DArray, GA1DArrayGenome<int>::EdgeRecombinationCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, 1DArray_Edge, make1DArray, GA1DArrayGenome<int>::EdgeComparator)->GA_BENCH_LENGTHS;
+
+BENCHMARK_CAPTURE(BM_Copy, 2DArray, make2DArray)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, 2DArray_Swap, make2DArray, GA2DArrayGenome<int>::SwapMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DArray_Uniform, make2DArray, GA2DArrayGenome<int>::UniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DArray_EvenOdd, make2DArray, GA2DArrayGenome<int>::EvenOddCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, 2DArray_OnePoint, make2DArray, GA2DArrayGenome<int>::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, 2DArray_Element, make2DArray, GA2DArrayGenome<int>::ElementComparator)->GA_BENCH_LENGTHS;
+
+/* ----------------------------------------------------------------------------
+   Allele (real number) arrays
+---------------------------------------------------------------------------- */
+BENCHMARK_CAPTURE(BM_Copy, Real, makeReal)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, Real_Uniform, makeReal, GARealUniformMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Mutator, Real_Gaussian, makeReal, GARealGaussianMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, Real_Uniform, makeReal, GARealUniformCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, Real_Arithmetic, makeReal, GARealArithmeticCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Crossover, Real_Blend, makeReal, GARealBlendCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, Real_Element, makeReal, GA1DArrayGenome<float>::ElementComparator)->GA_BENCH_LENGTHS;
+
+/* ----------------------------------------------------------------------------
+   Operators without the type checks (compare with the checked ones above)
+---------------------------------------------------------------------------- */
+BENCHMARK_CAPTURE(BM_UncheckedMutator, 1DBinStr_Flip, make1DBinStr, GA1DBinaryStringGenome::FlipMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedCrossover, 1DBinStr_OnePoint, make1DBinStr, GA1DBinaryStringGenome::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedCrossover, 1DBinStr_TwoPoint, make1DBinStr, GA1DBinaryStringGenome::TwoPointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedMutator, 1DArray_Swap, make1DArray, GA1DArrayGenome<int>::SwapMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedCrossover, 1DArray_OnePoint, make1DArray, GA1DArrayGenome<int>::OnePointCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedMutator, Real_Gaussian, makeReal, GARealGaussianMutator)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_UncheckedCrossover, Real_Blend, makeReal, GARealBlendCrossover)->GA_BENCH_LENGTHS;
+
+/* ----------------------------------------------------------------------------
+   Lists and trees
+---------------------------------------------------------------------------- */
+BENCHMARK_CAPTURE(BM_Copy, List, makeList)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, List_Swap, makeList, GAListGenome<int>::SwapMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, List_Destructive, makeList, GAListGenome<int>::DestructiveMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, List_OnePoint, makeList, GAListGenome<int>::OnePointCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, List_PartialMatch, makeList, GAListGenome<int>::PartialMatchCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, List_Order, makeList, GAListGenome<int>::OrderCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, List_Cycle, makeList, GAListGenome<int>::CycleCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, List_Node, makeList, GAListGenome<int>::NodeComparator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, List_EdgeRecombination, makeList, GAListGenome<int>::EdgeRecombinationCrossover)->GA_BENCH_LENGTHS;
+BENCHMARK_CAPTURE(BM_Comparator, List_Edge, makeList, GAListGenome<int>::EdgeComparator)->GA_BENCH_LENGTHS;
+
+BENCHMARK_CAPTURE(BM_Copy, ArrayList, makeArrayList)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, ArrayList_Swap, makeArrayList, GAArrayListGenome<int>::SwapMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, ArrayList_PartialMatch, makeArrayList, GAArrayListGenome<int>::PartialMatchCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, ArrayList_Order, makeArrayList, GAArrayListGenome<int>::OrderCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, ArrayList_Cycle, makeArrayList, GAArrayListGenome<int>::CycleCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, ArrayList_EdgeRecombination, makeArrayList, GAArrayListGenome<int>::EdgeRecombinationCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, ArrayList_Node, makeArrayList, GAArrayListGenome<int>::NodeComparator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, ArrayList_Edge, makeArrayList, GAArrayListGenome<int>::EdgeComparator)->GA_BENCH_NODES;
+
+BENCHMARK_CAPTURE(BM_Copy, Tree, makeTree)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, Tree_SwapNode, makeTree, GATreeGenome<int>::SwapNodeMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, Tree_SwapSubtree, makeTree, GATreeGenome<int>::SwapSubtreeMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, Tree_Destructive, makeTree, GATreeGenome<int>::DestructiveMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, Tree_OnePoint, makeTree, GATreeGenome<int>::OnePointCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, Tree_Topology, makeTree, GATreeGenome<int>::TopologyComparator)->GA_BENCH_NODES;
+
+BENCHMARK_CAPTURE(BM_Copy, FlatTree, makeFlatTree)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, FlatTree_SwapNode, makeFlatTree, GAFlatTreeGenome<int>::SwapNodeMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, FlatTree_SwapSubtree, makeFlatTree, GAFlatTreeGenome<int>::SwapSubtreeMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Mutator, FlatTree_Destructive, makeFlatTree, GAFlatTreeGenome<int>::DestructiveMutator)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Crossover, FlatTree_OnePoint, makeFlatTree, GAFlatTreeGenome<int>::OnePointCrossover)->GA_BENCH_NODES;
+BENCHMARK_CAPTURE(BM_Comparator, FlatTree_Topology, makeFlatTree, GAFlatTreeGenome<int>::TopologyComparator)->GA_BENCH_NODES;
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include "GABench.h"
+
+#include <memory>
+
+// Each call forces the work to be redone even though nothing has changed in
+// the population, which is what happens every generation in the engines.
+static void BM_PopulationSort(benchmark::State &state)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), state.range(1)));
+	for (auto _ : state)
+	{
+		pop->sort(true);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PopulationStatistics(benchmark::State &state)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), state.range(1)));
+	for (auto _ : state)
+	{
+		pop->statistics(true);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Diversity compares every pair of individuals, so it is quadratic in the
+// population size and linear in the genome length.
+static void BM_PopulationDiversity(benchmark::State &state)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), state.range(1)));
+	for (auto _ : state)
+	{
+		pop->diversity(true);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PopulationEvaluate(benchmark::State &state)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), state.range(1)));
+	for (auto _ : state)
+	{
+		pop->evaluate(true);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_PopulationSort)->ArgsProduct({{16, 128, 1024}, {64}});
+BENCHMARK(BM_PopulationStatistics)->ArgsProduct({{16, 128, 1024}, {64}});
+BENCHMARK(BM_PopulationDiversity)->ArgsProduct({{16, 64, 256}, {64, 1024}});
+BENCHMARK(BM_PopulationEvaluate)->ArgsProduct({{16, 128, 1024}, {64, 1024}});
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include "GABench.h"
+
+#include <GAScaling.h>
+#include <GASelector.h>
+
+#include <memory>
+
+// Preparing the selector (update) is done once per generation, picking an
+// individual (select) once per parent, so they are timed separately.
+static void BM_SelectorUpdate(benchmark::State &state, const GASelectionScheme &s)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), 64));
+	pop->selector(s);
+	for (auto _ : state)
+	{
+		pop->prepselect(true);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Select(benchmark::State &state, const GASelectionScheme &s)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), 64));
+	pop->selector(s);
+	pop->prepselect(true);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(&pop->select());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Scaling(benchmark::State &state, const GAScalingScheme &s)
+{
+	std::unique_ptr<GAPopulation> pop(GABenchPopulation(state.range(0), 64));
+	pop->scaling(s);
+	for (auto _ : state)
+	{
+		pop->scale(true);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+// The niching schemes compare every pair of genomes.  With this comparator
+// they time the scheme itself rather than the comparator of the genome.
+static float GABenchTrivialComparator(const GAGenome &, const GAGenome &)
+{
+	return 0.5;
+}
+
+// Population sizes for the selection and scaling benchmarks.
+#define GA_BENCH_POPSIZES RangeMultiplier(4)->Range(16, 1024)
+
+#define GA_BENCH_SELECTOR(name, s)                                             \
+	BENCHMARK_CAPTURE(BM_SelectorUpdate, name, s)->GA_BENCH_POPSIZES;         \
+	BENCHMARK_CAPTURE(BM_Select, name, s)->GA_BENCH_POPSIZES
+
+GA_BENCH_SELECTOR(Rank, GARankSelector());
+GA_BENCH_SELECTOR(RouletteWheel, GARouletteWheelSelector());
+GA_BENCH_SELECTOR(Tournament, GATournamentSelector());
+GA_BENCH_SELECTOR(Uniform, GAUniformSelector());
+GA_BENCH_SELECTOR(SRS, GASRSSelector());
+GA_BENCH_SELECTOR(DS, GADSSelector());
+
+BENCHMARK_CAPTURE(BM_Scaling, None, GANoScaling())->GA_BENCH_POPSIZES;
+BENCHMARK_CAPTURE(BM_Scaling, Linear, GALinearScaling())->GA_BENCH_POPSIZES;
+BENCHMARK_CAPTURE(BM_Scaling, SigmaTruncation, GASigmaTruncationScaling())->GA_BENCH_POPSIZES;
+BENCHMARK_CAPTURE(BM_Scaling, PowerLaw, GAPowerLawScaling())->GA_BENCH_POPSIZES;
+#if USE_SHARING == 1
+BENCHMARK_CAPTURE(BM_Scaling, Sharing, GASharing())->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_CAPTURE(BM_Scaling, SharingTrivial, GASharing(GABenchTrivialComparator))
+	->RangeMultiplier(4)
+	->Range(16, 256);
+#endif
+#if USE_CLEARING == 1
+BENCHMARK_CAPTURE(BM_Scaling, Clearing, GAClearing())->RangeMultiplier(4)->Range(16, 256);
+BENCHMARK_CAPTURE(BM_Scaling, ClearingTrivial, GAClearing(GABenchTrivialComparator))
+	->RangeMultiplier(4)
+	->Range(16, 256);
+#endif
@@ -0,0 +1,431 @@
+/* ----------------------------------------------------------------------------
+  GAWorkloads.cpp
+
+ DESCRIPTION:
+   End-to-end benchmark driver.  This runs the classic example problems (the
+DeJong functions from ex19, Holland's royal road from ex20 and the TSP from
+ex26) with each of the genetic algorithms for a fixed number of objective
+function evaluations, then reports how fast each one got there:
+
+     evals/s    objective evaluations per second
+     gens/s     generations (calls to step) per second
+     target     seconds (and evaluations) until the best score reached the
+                target score for the problem, or '-' if it never did
+     peak_kb    peak resident memory during the run (Linux only)
+
+   Usage:  GAlibWorkloads [problem name] [engine name] [evals n] [popsize n]
+                          [length n] [target x] [seed n] [json]
+
+   problem is one of dejong1 ... dejong5, royalroad, tsp or all (default).
+   engine is one of simple, steadystate, incremental, crowding, deme or all
+   (default).  The length scales the genome: it is the number of bits per
+   variable for the DeJong functions, the number of blocks (a power of 2) for
+   the royal road and the number of towns for the TSP.
+---------------------------------------------------------------------------- */
+#include <GABin2DecGenome.h>
+#include <GADCrowdingGA.h>
+#include <GADemeGA.h>
+#include <GAIncGA.h>
+#include <GAListGenome.hpp>
+#include <GASStateGA.h>
+#include <GAScaling.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include "ex19.hpp"
+#include "ex20.hpp"
+#include "ex26.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+const char *gaWorkloadProblems[] = {"dejong1", "dejong2", "dejong3", "dejong4",
+									"dejong5", "royalroad", "tsp"};
+const char *gaWorkloadEngines[] = {"simple", "steadystate", "incremental",
+								   "crowding", "deme"};
+
+// A run gives up after this many steps in a row without an evaluation.
+const int gaWorkloadStallSteps = 1000;
+
+// Every evaluation goes through this wrapper so that we count the calls to
+// the objective function rather than the evaluation requests made by the
+// genetic algorithms (those include children that were never changed).  The
+// wrapper also keeps track of the best score and when the target was hit, so
+// this works the same way for all of the genetic algorithms.
+static struct
+{
+	GAGenome::Evaluator objective;
+	bool minimize;
+	float target;
+	unsigned long int evals;
+	float best;
+	std::chrono::steady_clock::time_point start;
+	double targetSeconds;
+	unsigned long int targetEvals;
+} workload;
+
+static float countedObjective(GAGenome &g)
+{
+	float score = (*workload.objective)(g);
+	workload.evals++;
+	if (workload.evals == 1 ||
+		(workload.minimize ? score < workload.best : score > workload.best))
+	{
+		workload.best = score;
+	}
+	if (workload.targetSeconds < 0 && !std::isnan(workload.target) &&
+		(workload.minimize ? score <= workload.target : score >= workload.target))
+	{
+		workload.targetSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - workload.start).count();
+		workload.targetEvals = workload.evals;
+	}
+	return score;
+}
+
+// Forget the peak memory of previous runs.  This only works on Linux, other
+// systems report the peak of the whole process.
+static void resetPeakMemory()
+{
+#if defined(__linux__)
+	std::ofstream clear("/proc/self/clear_refs");
+	if (clear)
+	{
+		clear << "5";
+	}
+#endif
+}
+
+// Peak resident memory in kB (0 if we do not know how to get it).
+static long peakMemory()
+{
+#if defined(__linux__)
+	std::ifstream status("/proc/self/status");
+	std::string key;
+	while (status >> key)
+	{
+		if (key == "VmHWM:")
+		{
+			long kb = 0;
+			status >> kb;
+			return kb;
+		}
+		status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	}
+	return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+#else
+	return 0;
+#endif
+}
+
+/* ----------------------------------------------------------------------------
+   The problems.  Each one builds its sample genome and sets the same
+parameters that the example does.  A target of NaN means that there is no
+target score for the problem.
+---------------------------------------------------------------------------- */
+struct GAWorkload
+{
+	std::unique_ptr<GAGenome> genome;
+	bool minimize = false;
+	float target = std::numeric_limits<float>::quiet_NaN();
+	int popsize = 30;
+	float pmut = 0.001;
+	float pcross = 0.9;
+	float prepl = 0.25;
+	bool sigmaTruncation = true;
+};
+
+static bool makeWorkload(GAWorkload &w, const std::string &problem, int length)
+{
+	if (problem.compare(0, 6, "dejong") == 0 && problem.size() == 7)
+	{
+		int which = problem[6] - '1';
+		if (which < 0 || which > 4)
+		{
+			return false;
+		}
+		// f1 to f4 are minimized, f5 (Shekel's foxholes, as written in ex19)
+		// is maximized.  The noise in f4 makes a target meaningless.
+		const float targets[5] = {0.01, 0.01, 0.0,
+								  std::numeric_limits<float>::quiet_NaN(), 499.0};
+		workload.objective = objectiveEx19[which];
+		w.genome.reset(new GABin2DecGenome(
+			dejongMapEx19(which, length > 0 ? length : 16), countedObjective));
+		w.minimize = (which != 4);
+		w.target = targets[which];
+		return true;
+	}
+	if (problem == "royalroad")
+	{
+		int blocks = length > 0 ? length : 16;
+		if ((blocks & (blocks - 1)) != 0)
+		{
+			std::cerr << "the number of royal road blocks must be a power of 2\n";
+			return false;
+		}
+		royalRoadSizeEx20(blocks);
+		workload.objective = RoyalRoad;
+		w.genome.reset(new GA1DBinaryStringGenome(nbits, countedObjective));
+		w.target = royalRoadOptimumEx20();
+		w.popsize = 512;
+		return true;
+	}
+	if (problem == "tsp")
+	{
+		float shortest = gridTownsEx26(length > 0 ? length : 20);
+		workload.objective = objectiveEx26;
+		auto *genome = new GAListGenome<int>(countedObjective);
+		genome->initializer(initializerEx26);
+		genome->mutator(mutatorEx26);
+		genome->comparator(GAListGenome<int>::EdgeComparator);
+		genome->crossover(GAListGenome<int>::EdgeRecombinationCrossover);
+		w.genome.reset(genome);
+		w.minimize = true;
+		if (shortest > 0)
+		{
+			w.target = shortest;
+		}
+		w.popsize = 100;
+		w.pmut = 0.1;
+		w.pcross = 1.0;
+		w.prepl = 1.0;
+		w.sigmaTruncation = false;
+		return true;
+	}
+	return false;
+}
+
+static GAGeneticAlgorithm *makeEngine(const std::string &engine, const GAGenome &g)
+{
+	if (engine == "simple")
+	{
+		return new GASimpleGA(g);
+	}
+	if (engine == "steadystate")
+	{
+		return new GASteadyStateGA(g);
+	}
+	if (engine == "incremental")
+	{
+		return new GAIncrementalGA(g);
+	}
+	if (engine == "crowding")
+	{
+		return new GADCrowdingGA(g);
+	}
+	if (engine == "deme")
+	{
+		return new GADemeGA(g);
+	}
+	return nullptr;
+}
+
+/* ----------------------------------------------------------------------------
+   Run one problem with one engine until the evaluation budget is used up.
+---------------------------------------------------------------------------- */
+struct GAWorkloadResult
+{
+	double seconds = 0;
+	unsigned long int evals = 0;
+	int generations = 0;
+	float best = 0;
+	double targetSeconds = -1;
+	unsigned long int targetEvals = 0;
+	long peakKB = 0;
+};
+
+static bool runWorkload(const std::string &problem, const std::string &engine,
+						unsigned long int budget, int popsize, int length,
+						float target, unsigned int seed, GAWorkloadResult &r)
+{
+	GAWorkload w;
+	if (!makeWorkload(w, problem, length))
+	{
+		std::cerr << "cannot set up problem " << problem << "\n";
+		return false;
+	}
+	if (!std::isnan(target))
+	{
+		w.target = target;
+	}
+
+	std::unique_ptr<GAGeneticAlgorithm> ga(makeEngine(engine, *w.genome));
+	if (!ga)
+	{
+		std::cerr << "unknown engine: " << engine << "\n";
+		return false;
+	}
+	if (w.minimize)
+	{
+		ga->minimize();
+	}
+	ga->populationSize(popsize > 0 ? popsize : w.popsize);
+	ga->pMutation(w.pmut);
+	ga->pCrossover(w.pcross);
+	if (auto *ssga = dynamic_cast<GASteadyStateGA *>(ga.get()))
+	{
+		ssga->pReplacement(w.prepl);
+	}
+	ga->scoreFrequency(0);
+	GASigmaTruncationScaling trunc;
+	if (w.sigmaTruncation)
+	{
+		ga->scaling(trunc);
+	}
+
+	resetPeakMemory();
+	GAResetRNG(seed);
+	workload.minimize = w.minimize;
+	workload.target = w.target;
+	workload.evals = 0;
+	workload.targetSeconds = -1;
+	workload.targetEvals = 0;
+	workload.start = std::chrono::steady_clock::now();
+
+	ga->initialize(seed);
+	int stalled = 0;
+	while (workload.evals < budget && stalled < gaWorkloadStallSteps)
+	{
+		unsigned long int before = workload.evals;
+		ga->step();
+		stalled = (workload.evals == before ? stalled + 1 : 0);
+	}
+	if (stalled >= gaWorkloadStallSteps)
+	{
+		std::cerr << engine << " stopped evaluating on " << problem << " after "
+				  << workload.evals << " evaluations\n";
+	}
+
+	r.seconds = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - workload.start).count();
+	r.evals = workload.evals;
+	r.generations = ga->statistics().generation();
+	r.best = workload.best;
+	r.targetSeconds = workload.targetSeconds;
+	r.targetEvals = workload.targetEvals;
+	r.peakKB = peakMemory();
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	std::string problem = "all", engine = "all";
+	unsigned long int budget = 20000;
+	int popsize = 0, length = 0;
+	float target = std::numeric_limits<float>::quiet_NaN();
+	unsigned int seed = 1;
+	bool json = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp("json", argv[i]) == 0)
+		{
+			json = true;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			std::cerr << argv[0] << ": missing value for " << argv[i] << "\n";
+			exit(1);
+		}
+		if (strcmp("problem", argv[i]) == 0)
+			problem = argv[++i];
+		else if (strcmp("engine", argv[i]) == 0)
+			engine = argv[++i];
+		else if (strcmp("evals", argv[i]) == 0)
+			budget = atol(argv[++i]);
+		else if (strcmp("popsize", argv[i]) == 0)
+			popsize = atoi(argv[++i]);
+		else if (strcmp("length", argv[i]) == 0)
+			length = atoi(argv[++i]);
+		else if (strcmp("target", argv[i]) == 0)
+			target = atof(argv[++i]);
+		else if (strcmp("seed", argv[i]) == 0)
+			seed = atoi(argv[++i]);
+		else
+		{
+			std::cerr << argv[0] << ": unrecognized argument: " << argv[i] << "\n";
+			exit(1);
+		}
+	}
+
+	std::vector<std::string> problems, engines;
+	for (auto p : gaWorkloadProblems)
+		if (problem == "all" || problem == p)
+			problems.emplace_back(p);
+	for (auto e : gaWorkloadEngines)
+		if (engine == "all" || engine == e)
+			engines.emplace_back(e);
+	if (problems.empty() || engines.empty())
+	{
+		std::cerr << argv[0] << ": unknown problem or engine\n";
+		exit(1);
+	}
+
+	if (json)
+		std::cout << "[";
+	else
+		std::cout << "# problem\tengine\tevals\tgenerations\tseconds\tevals/s\t"
+					 "gens/s\tbest\ttarget_s\ttarget_evals\tpeak_kb\n";
+
+	bool first = true;
+	for (auto &p : problems)
+	{
+		for (auto &e : engines)
+		{
+			GAWorkloadResult r;
+			if (!runWorkload(p, e, budget, popsize, length, target, seed, r))
+				exit(1);
+			double evalRate = r.seconds > 0 ? r.evals / r.seconds : 0;
+			double genRate = r.seconds > 0 ? r.generations / r.seconds : 0;
+			if (json)
+			{
+				std::cout << (first ? "\n" : ",\n") << "  {\"problem\": \"" << p
+						  << "\", \"engine\": \"" << e << "\", \"evals\": " << r.evals
+						  << ", \"generations\": " << r.generations
+						  << ", \"seconds\": " << r.seconds
+						  << ", \"evals_per_second\": " << evalRate
+						  << ", \"generations_per_second\": " << genRate
+						  << ", \"best\": " << r.best << ", \"target_seconds\": ";
+				if (r.targetSeconds < 0)
+					std::cout << "null, \"target_evals\": null";
+				else
+					std::cout << r.targetSeconds << ", \"target_evals\": " << r.targetEvals;
+				std::cout << ", \"peak_kb\": " << r.peakKB << "}";
+			}
+			else
+			{
+				std::cout << p << "\t" << e << "\t" << r.evals << "\t"
+						  << r.generations << "\t" << r.seconds << "\t" << evalRate
+						  << "\t" << genRate << "\t" << r.best << "\t";
+				if (r.targetSeconds < 0)
+					std::cout << "-\t-";
+				else
+					std::cout << r.targetSeconds << "\t" << r.targetEvals;
+				std::cout << "\t" << r.peakKB << "\n";
+			}
+			std::cout.flush();
+			first = false;
+		}
+	}
+	if (json)
+		std::cout << "\n]\n";
+
+	return 0;
+}
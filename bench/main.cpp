@@ -0,0 +1,4 @@
+#include <benchmark/benchmark.h>
+
+// Use --benchmark_out=<file> --benchmark_out_format=json to record results.
+BENCHMARK_MAIN();
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <GABin2DecGenome.h>
+#include <garandom.h>
+
+#include <cmath>
+
+
+double Gauss(double mean, double variance);
+
+// DeJong's first function is:
+//
+// f1(x1,x2,x3) = x1*x1 + x2*x2 + x3*x3
+//
+// where each x is in the range [-5.12,5.12]
+float
+DeJong1(GAGenome & c)
+{
+  auto & genome = (GABin2DecGenome &)c;
+  float value=0;
+  value += genome.phenotype(0) * genome.phenotype(0);
+  value += genome.phenotype(1) * genome.phenotype(1);
+  value += genome.phenotype(2) * genome.phenotype(2);
+  return(value);
+}
+
+
+// DeJong's second function is:
+//
+// f2(x1,x2) = 100 * (x1*x1 - x2)^2 + (1 - x1)^2
+//
+// where each x is in the range [-2.048,2.048]
+float
+DeJong2(GAGenome & c)
+{
+  auto & genome = (GABin2DecGenome &)c;
+  float value=100.0;
+  value *= genome.phenotype(0) * genome.phenotype(0) - genome.phenotype(1);
+  value *= genome.phenotype(0) * genome.phenotype(0) - genome.phenotype(1);
+  value += (1 - genome.phenotype(0))*(1 - genome.phenotype(0));
+  return(value);
+}
+
+
+// DeJong's third function is:
+//
+// f3(x1,x2,x3,x4,x5) = 
+//      25 + floor(x1) + floor(x2) + floor(x3) + floor(x4) + floor(x5)
+//
+// where each x is in the range [-5.12,5.12]
+float
+DeJong3(GAGenome & c)
+{
+  auto & genome = (GABin2DecGenome &)c;
+  float value=25.0;
+  value -= floor(genome.phenotype(0));
+  value -= floor(genome.phenotype(1));
+  value -= floor(genome.phenotype(2));
+  value -= floor(genome.phenotype(3));
+  value -= floor(genome.phenotype(4));
+  return(value);
+}
+
+
+// DeJong's fourth function is:
+//
+//             30
+//            ___
+// f4(xi) =   \   { i * xi^4 + Gauss(0,1) }
+//            /__
+//            i=1
+//
+// where each x is in the range [-1.28,1.28]
+float
+DeJong4(GAGenome & c)
+{
+  auto & genome = (GABin2DecGenome &)c;
+  float value = 0;
+  for(int i=0; i<30; i++){
+    float v = genome.phenotype(i);
+    v *= v;			// xi^2
+    v *= v;			// xi^4
+    v *= i;
+    v += Gauss(0,1);
+    value += v;
+  }
+  return(value);
+}
+
+
+// DeJong's fifth function is (Shekel's foxholes):
+//
+//
+//               25                 1
+//               ___    ---------------------------
+// f5(x1,x2) =   \              2
+//               /__           ___ 
+//               j=1      j +  \   (x[i] - a[i][j])^6
+//                             /__
+//                             i=1
+//
+// where each x is in the range [-65.536,65.536]
+//
+static int foxholesEx19[2][25] ={
+  {-32, -16, 0, 16, 32, -32, -16, 0, 16, 32, -32, -16, 0, 16, 32,
+   -32, -16, 0, 16, 32, -32, -16, 0, 16, 32        },
+  {-32, -32, -32, -32, -32, -16, -16, -16, -16, -16,
+   16, 16, 16, 16, 16, 32, 32, 32, 32, 32  }
+};
+
+float
+DeJong5(GAGenome & c)
+{
+  auto & genome = (GABin2DecGenome &)c;
+
+  float prod,total=0.002;
+
+  for(int j=0; j<25; j+=1) {
+    float lowtot=1.0 + (double)j;
+    for(int i=0; i<2; i+=1) {
+      prod=1.0;
+      for(int power=0; power<6; power+=1)
+        prod*=genome.phenotype(i)-foxholesEx19[i][j];
+      lowtot+=prod;
+    }
+    total+=1.0/lowtot;
+  }
+
+  return(500.0 - (1.0/total));
+}
+
+
+// Return a number from gaussian distribution.  This code was pinched from the
+// GNU libg++ Normal.cc implementation of a normal distribution.  That is, in
+// turn, based on Simulation, Modelling & Analysis by Law & Kelton, pp259.
+//
+// My random number generator (actually just the system's) isn't as good as 
+// that in the libg++, but this should be OK for this purpose.
+double
+Gauss(double mean, double variance){
+  for(;;) {
+    double u1 = GARandomDouble();
+    double u2 = GARandomDouble();
+    double v1 = 2 * u1 - 1;
+    double v2 = 2 * u2 - 1;
+    double w = (v1 * v1) + (v2 * v2);
+
+    if (w <= 1) {
+      double y = sqrt( (-2 * log(w)) / w);
+      double x1 = v1 * y;
+//      double x2 = v2 * y;       // we don't use this one
+      return(x1 * sqrt(variance) + mean);
+    }
+  }
+}
+
+GAGenome::Evaluator objectiveEx19[5] = {DeJong1,DeJong2,DeJong3,DeJong4,DeJong5};
+
+// Create the phenotype map for one of the DeJong functions (0-4).  Each
+// variable is encoded with nbits bits, so nbits sets the genome length.
+GABin2DecPhenotype dejongMapEx19(int whichFunction, int nbits = 16)
+{
+  GABin2DecPhenotype map;
+  switch(whichFunction){
+  case 0:
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    break;
+
+  case 1:
+    map.add(nbits, -2.048, 2.048);
+    map.add(nbits, -2.048, 2.048);
+    break;
+
+  case 2:
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    map.add(nbits, -5.12, 5.12);
+    break;
+
+  case 3:
+    {
+      for(int j=0; j<30; j++)
+	map.add(nbits, -1.28, 1.28);
+    }
+    break;
+
+  case 4:
+    map.add(nbits, -65.536, 65.536);
+    map.add(nbits, -65.536, 65.536);
+    break;
+
+  default:
+    map.add(nbits, 0, 0);
+    break;
+  }
+  return map;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <GA1DBinStrGenome.h>
+
+#include <vector>
+
+
+// This is the objective function for computing Holland's 1993 ICGA version
+// of the Royal Road problem.  It has been corrected per GAList volume 7
+// number 23, 8/26/93.  No bonus points are awarded for a given level until 
+// it has been achieved (this fixes Holland's coding error in GAList).
+//   Holland posed this problem as a challenge to test the 
+// performance of genetic algorithms.  He indicated that, with the parameter 
+// settings of
+//
+//     schemata size = 8
+//     bits between schemata = 7
+//     m* = 4
+//     U* = 1.0
+//     u = 0.3
+//     v = 0.02
+//
+// he could attain royal_road_level 3 most of the time within
+// 10,000 function evaluations.  He challenged other GA users to match or beat
+// that performance.  He indicated that he used a population size of 512 to
+// obtain his solutions, and did NOT use a "simple genetic algorithm."
+//   The genome for this problem is a single-dimension bit string with length
+// defined by the block size and gap size as:
+//
+//     length = (blocksize+gapsize) * (2^K)
+//
+// where K= 1,2,3, or 4.  Holland used K = 4.  The number of blocks can be
+// changed with royalRoadSizeEx20 to make longer (or shorter) genomes.
+
+const int BLOCKSIZE=8;	// block size - length of target schemata
+const int GAPSIZE=7;	// gap size - number of bits between target schemata
+const int MSTAR=4;	// Holland's m* - up to this many bits in low level
+			// block gets reward
+const float USTAR=1.0;     // Holland's U* - first block earns this
+const float RR_U=0.3;      // Holland's u - increment for lowest level match
+const float RR_V=0.02;     // Holland's v - reward/penalty per bit
+
+int nblocks = 16;		// this number is 2^K
+int nbits = (BLOCKSIZE+GAPSIZE)*nblocks;
+std::vector<int> blockarray(nblocks);
+int highestLevel=0;
+
+// Set the number of blocks (must be a power of 2) and reset the level counter.
+void royalRoadSizeEx20(int n)
+{
+  nblocks = n;
+  nbits = (BLOCKSIZE+GAPSIZE)*nblocks;
+  blockarray.assign(nblocks, 0);
+  highestLevel = 0;
+}
+
+// The score of a genome with every block filled in.
+float royalRoadOptimumEx20()
+{
+  float score = USTAR + (nblocks-1)*RR_U;
+  for(int n=nblocks/2; n>0; n/=2)
+    score += USTAR + (n-1)*RR_U;
+  return score;
+}
+
+float
+RoyalRoad(GAGenome & c){
+  auto & genome = (GA1DBinaryStringGenome &)c;
+
+  float score = 0.0;
+  int total, i, j, index, n;
+
+// do the lowest level blocks first
+
+  n = 0;
+  for(i=0; i<nblocks; i++) {
+    total = 0;
+    for(j=i*(BLOCKSIZE + GAPSIZE); j<i*(BLOCKSIZE+GAPSIZE)+BLOCKSIZE; j++)
+      if(genome.gene(j) == 1) total++;  // count the bits in the block
+    if(total > MSTAR && total < BLOCKSIZE)
+      score -= (total-MSTAR)*RR_V;
+    else if(total <= MSTAR)
+      score += total * RR_V;
+    if(total == BLOCKSIZE) {
+      blockarray[i] = 1;
+      n++;
+    }
+    else{
+      blockarray[i] = 0;
+    }
+  }
+
+// bonus for filled low-level blocks
+
+  if(n > 0) score += USTAR + (n-1)*RR_U;
+
+// now do the higher-level blocks
+
+  n = nblocks;		// n is now number of filled low level blocks
+  int proceed = 1;		// should we look at the next higher level?
+  int level = 0;
+  while ((n > 1) && proceed) {
+    proceed = 0;
+    total = 0;
+      /* there are n valid blocks in the blockarray each time */
+      /* round, so n=2 is the last.                           */
+    for(i=0,index=0; i<(n/2)*2; i+=2,index++) {
+      if(blockarray[i] == 1 && blockarray[i+1] == 1) {
+	total++;
+	proceed = 1;
+	blockarray[index] = 1;
+      }
+      else{
+	blockarray[index] = 0;
+      }
+    }
+    if(total > 0){
+      score += USTAR + (total-1)*RR_U;
+      level++;
+    }
+    n /= 2;
+  }
+
+  if(highestLevel < level) highestLevel = level;
+
+  return(score);
+}
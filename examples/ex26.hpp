@@ -0,0 +1,236 @@
+#pragma once
+
+#include <GAListGenome.hpp>
+#include <garandom.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+
+// The towns and the distances between them.  The towns are either read from
+// a file in the format that is used by the TSPLIB problems or laid out on a
+// grid (so it is easy to figure out what the shortest distance is, and there
+// are many different paths with the same shortest path).
+std::vector<std::vector<float>> DISTANCE;
+std::vector<double> x, y;
+int ntowns = 0;
+
+void distancesEx26()
+{
+  DISTANCE.assign(ntowns, std::vector<float>(ntowns, 0.0));
+  double dx,dy;
+  for(int i=0;i<ntowns;i++) {
+    for(int j=i; j<ntowns;j++) {
+      dx=x[i]-x[j]; dy=y[i]-y[j];
+      DISTANCE[j][i]=DISTANCE[i][j]=sqrt(dx*dx+dy*dy);
+    }
+  }
+}
+
+// Read the towns from file.  Returns false if the file could not be read.
+bool readTownsEx26(const char *filename)
+{
+  std::ifstream in(filename);
+  if(!in) return false;
+  x.clear(); y.clear();
+  double dump, xx, yy;
+  while(in >> dump >> xx >> yy) {
+    x.push_back(xx);
+    y.push_back(yy);
+  }
+  ntowns = x.size();
+  distancesEx26();
+  return ntowns > 0;
+}
+
+// Lay out n towns on a grid with unit spacing that is as square as possible.
+// If n is even one of the sides is even too, so the shortest tour is n (the
+// sample problem is the same grid with 20 towns).  Returns the length of the
+// shortest tour, or 0 if we do not know it.
+float gridTownsEx26(int n)
+{
+  int w = (int)sqrt((double)n);
+  while(w > 1 && n % w != 0) w--;
+  int h = n / w;
+  x.resize(n); y.resize(n);
+  for(int i=0; i<n; i++) {
+    x[i] = 1 + i / w;
+    y[i] = 1 + i % w;
+  }
+  ntowns = n;
+  distancesEx26();
+  return (w > 1 && (w % 2 == 0 || h % 2 == 0)) ? (float)n : 0.0;
+}
+
+
+// Here are the genome operators that we want to use for this problem.
+// Thanks to Jan Kees IJspeert for isolating an order-of-evaluation problem
+// in the previous implementation of this function.
+float
+objectiveEx26(GAGenome& g) {
+  auto & genome = (GAListGenome<int> &)g;
+  float dist = 0;
+  if(genome.head()) {
+    for(int i=0; i<ntowns; i++) {
+      int xx = *genome.current();
+      int yy = *genome.next();
+      dist += DISTANCE[xx][yy];
+    }
+  }
+  return dist;
+}
+
+void
+initializerEx26(GAGenome& g) {
+  auto &child=(GAListGenome<int> &)g;
+  while(child.head()) child.destroy(); // destroy any pre-existing list
+
+  int i,town;
+  static std::vector<char> visit;
+
+  visit.assign(ntowns, 0);
+  town=GARandomInt(0,ntowns-1);
+  visit[town]=1;
+  child.insert(town,GAListBASE::HEAD); // the head node
+
+  for( i=1; i<ntowns; i++) {
+    do {
+      town=GARandomInt(0,ntowns-1);
+    } while (visit[town]);
+    visit[town]=1;
+    child.insert(town);
+  }		// each subsequent node
+}
+
+int mutatorEx26(GAGenome& g, float pmut)
+{
+    auto &child=(GAListGenome<int> &)g;
+
+    if ((GARandomFloat() >= pmut) || (pmut <= 0))
+        return 0;
+
+    int n = child.size();
+
+    if (GARandomFloat()<0.5)
+    {
+        child.swap(GARandomInt(0,n-1),GARandomInt(0,n-1)); // swap only one time
+    }
+    else
+    {
+        int nNodes = GARandomInt(1,((int)(n/2-1)));       // displace nNodes
+        child.warp(GARandomInt(0,n-1));                   // with or without
+        GAList<int> TmpList;                              // inversion
+        for(int i=0; i < nNodes; i++)
+        {
+            int *iptr = child.remove();
+            TmpList.insert(*iptr,GAListBASE::AFTER);
+            delete iptr;
+            child.next();
+        }
+
+        child.warp(GARandomInt(0,n-nNodes));
+        int invert = (GARandomFloat()<0.5) ? 0 : 1;
+        if (invert)
+            TmpList.head();
+        else
+            TmpList.tail();
+
+        for(int i = 0; i < nNodes; i++)
+        {
+            int *iptr = TmpList.remove();
+            child.insert(*iptr,GAListBASE::AFTER);
+            delete iptr;
+
+            if (invert)
+                TmpList.prev();
+            else
+                TmpList.next();
+        }
+    }
+    child.head();		// set iterator to root node
+
+    return (1);
+}
+
+// The partial match crossover is here for comparison.  The edge recombination
+// crossover and the edge comparator come with the list genome.
+int
+PMXoverEx26(const GAGenome& g1, const GAGenome& g2, GAGenome* c1, GAGenome* c2) {
+  auto &mom=(GAListGenome<int> &)g1;
+  auto &dad=(GAListGenome<int> &)g2;
+
+  int a = GARandomInt(0, mom.size());
+  int b = GARandomInt(0, dad.size());
+
+  if (b < a)
+  {
+      int h=a;
+      a=b;
+      b=h;
+  }
+
+  int* index;
+  int i,j,nc=0;
+
+  if(c1) {
+    auto &sis=(GAListGenome<int> &)*c1;
+    sis.GAList<int>::copy(mom);
+    GAListIter<int> diter(dad);
+    index = diter.warp(a);
+    for(i=a; i<b; i++, index=diter.next()){
+      if(*sis.head() == *index){
+	sis.swap(i,0);
+      }
+      else{
+	for(j=1; (j<sis.size()) && (*sis.next() != *index); j++);
+	sis.swap(i,j);  // no op if j>size
+      }
+    }
+    sis.head();         // set iterator to head of list
+    nc += 1;
+  }
+  if(c2) {
+    auto &sis=(GAListGenome<int> &)*c2;
+    sis.GAList<int>::copy(mom);
+    GAListIter<int> diter(dad);
+    index = diter.warp(a);
+    for(i=a; i<b; i++, index=diter.next()){
+      if(*sis.head() == *index){
+	sis.swap(i,0);
+      }
+      else{
+	for(j=1; (j<sis.size()) && (*sis.next() != *index); j++);
+	sis.swap(i,j);  // no op if j>size
+      }
+    }
+    sis.head();         // set iterator to head of list
+    nc += 1;
+  }
+
+  return nc;
+}
+
+//   Here we override the _write method for the List class.  This lets us see
+// exactly what we want (the default _write method dumps out pointers to the
+// data rather than the data contents).
+//   This routine prints out the contents of each element of the list,
+// separated by a space.  It does not put a newline at the end of the list.
+//   Notice that you can override ANY function of a template class.  This is
+// called "specialization" in C++ and it lets you tailor the behaviour of a
+// template class to better fit the type.
+template <>
+int GAListGenome<int>::write( std::ostream & os) const
+{
+    int *head;
+    GAListIter<int> tmpiter(*this);
+    if((head=tmpiter.head()) != nullptr)
+    {
+        os << *head << " ";
+        for(auto cur = tmpiter.next(); cur && cur != head; cur = tmpiter.next())
+            os << *cur << " ";
+    }
+
+  return os.fail() ? 1 : 0;
+}
@@ -27,14 +27,18 @@ that for common instantiations (float, char).
 
 #include "GAAllele.h"
 #include "GAArray.h"
+#include "GAEdgeRecombination.hpp"
 #include "GAGenome.h"
 #include "GAMask.h"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring> 
 #include "garandom.h"
-#include <vector>
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 /* ----------------------------------------------------------------------------
 1DArrayGenome
@@ -47,8 +51,11 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	// Randomly swap elements in the array.
 	static int SwapMutator(GAGenome &c, float pmut)
 	{
-		GA1DArrayGenome<T> &child = DYN_CAST(GA1DArrayGenome<T> &, c);
+		return TypedSwapMutator(DYN_CAST(GA1DArrayGenome<T> &, c), pmut);
+	}
 
+	static int TypedSwapMutator(GA1DArrayGenome<T> &child, float pmut)
+	{
 		if (pmut <= 0.0)
 			return (0);
 
@@ -96,21 +103,40 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		return count / sis.length();
 	}
 
+	//   Write the elements of the genome (which must convert to float) as the
+	// coordinates of a point, one for each element, for the niching schemes.
+	// The distance between those points is not what ElementComparator returns
+	// (that only counts the elements that differ), so the schemes only use this
+	// if you give it to them.
+	static void ElementEmbedding(const GAGenome &g, float *x)
+	{
+		const GA1DArrayGenome<T> &genome = DYN_CAST(const GA1DArrayGenome<T> &, g);
+		for (int i = 0; i < genome.length(); i++)
+			x[i] = STA_CAST(float, genome.gene(i));
+	}
+
 	// Randomly take bits from each parent.  For each bit we flip a coin to see
 	// if that bit should come from the mother or the father.  If strings are
 	// different lengths then we need to use the mask to get things right.
 	static int UniformCrossover(const GAGenome &p1, const GAGenome &p2,
 								GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =	DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =	DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedUniformCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedUniformCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int n = 0;
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
+			GA1DArrayGenome<T> &sis = *c1;
+			GA1DArrayGenome<T> &bro = *c2;
 
 			if (sis.length() == bro.length() 
 				&& mom.length() == dad.length() 
@@ -149,7 +175,7 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis = (c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)	: DYN_CAST(GA1DArrayGenome<T> &, *c2));
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 
 			if (mom.length() == dad.length() && sis.length() == mom.length())
 			{
@@ -179,26 +205,31 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	static int OnePointCrossover(const GAGenome &p1, const GAGenome &p2,
 								 GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =
-			DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =
-			DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedOnePointCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedOnePointCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		unsigned int momsite, momlen;
 		unsigned int dadsite, dadlen;
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
+			GA1DArrayGenome<T> &sis = *c1;
+			GA1DArrayGenome<T> &bro = *c2;
 
 			if (sis.resizeBehaviour() == GAGenome::FIXED_SIZE &&
 				bro.resizeBehaviour() == GAGenome::FIXED_SIZE)
 			{
-				if (mom.length() != dad.length() ||
-					sis.length() != bro.length() ||
-					sis.length() != mom.length())
+				if (GA_CHECK(mom.length() != dad.length() ||
+							 sis.length() != bro.length() ||
+							 sis.length() != mom.length()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -233,14 +264,12 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis =
-				(c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)
-					: DYN_CAST(GA1DArrayGenome<T> &, *c2));
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 
 			if (sis.resizeBehaviour() == GAGenome::FIXED_SIZE)
 			{
-				if (mom.length() != dad.length() ||
-					sis.length() != mom.length())
+				if (GA_CHECK(mom.length() != dad.length() ||
+							 sis.length() != mom.length()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -284,11 +313,16 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	static int TwoPointCrossover(const GAGenome &p1, const GAGenome &p2,
 								 GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =
-			DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =
-			DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedTwoPointCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedTwoPointCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		std::array<unsigned int, 2> momsite;
 		std::array<unsigned int, 2> momlen; 
@@ -297,15 +331,15 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
+			GA1DArrayGenome<T> &sis = *c1;
+			GA1DArrayGenome<T> &bro = *c2;
 
 			if (sis.resizeBehaviour() == GAGenome::FIXED_SIZE &&
 				bro.resizeBehaviour() == GAGenome::FIXED_SIZE)
 			{
-				if (mom.length() != dad.length() ||
-					sis.length() != bro.length() ||
-					sis.length() != mom.length())
+				if (GA_CHECK(mom.length() != dad.length() ||
+							 sis.length() != bro.length() ||
+							 sis.length() != mom.length()))
 				{
 					GAErr(GA_LOC, mom.className(), "two-point cross",
 						  GAError::SameLengthReqd);
@@ -359,14 +393,12 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis =
-				(c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)
-					: DYN_CAST(GA1DArrayGenome<T> &, *c2));
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 
 			if (sis.resizeBehaviour() == GAGenome::FIXED_SIZE)
 			{
-				if (mom.length() != dad.length() ||
-					sis.length() != mom.length())
+				if (GA_CHECK(mom.length() != dad.length() ||
+							 sis.length() != mom.length()))
 				{
 					GAErr(GA_LOC, mom.className(), "two-point cross",
 						  GAError::SameLengthReqd);
@@ -429,18 +461,23 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	static int EvenOddCrossover(const GAGenome &p1, const GAGenome &p2,
 								GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =
-			DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =
-			DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedEvenOddCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedEvenOddCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		int i;
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
+			GA1DArrayGenome<T> &sis = *c1;
+			GA1DArrayGenome<T> &bro = *c2;
 			if (sis.length() == bro.length() && mom.length() == dad.length() &&
 				sis.length() == mom.length())
 			{
@@ -472,9 +509,7 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis =
-				(c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)
-					: DYN_CAST(GA1DArrayGenome<T> &, *c2));
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 
 			if (mom.length() == dad.length() && sis.length() == mom.length())
 			{
@@ -506,25 +541,33 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	// Partial match crossover for the 1D array genome.  This uses the partial
 	// matching algorithm described in Goldberg's book.
 	//   Parents and children must be the same size for this crossover to work.
-	//   If
-	// they are not, we post an error message.
+	// If they are not, we post an error message.
 	//   We make sure that b will be greater than a.
+	//   When the elements are distinct integers (a permutation, usually) we
+	// keep a table of where each element is, so each swap finds its partner
+	// with a lookup rather than a search.  Otherwise we search.  Either way the
+	// children are the same.
 	static int PartialMatchCrossover(const GAGenome &p1, const GAGenome &p2,
 									 GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =
-			DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =
-			DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedPartialMatchCrossover(
+			DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedPartialMatchCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		int a = GARandomInt(0, mom.length());
 		int b = GARandomInt(0, dad.length());
 		if (b < a)
 			SWAP(a, b);
-		int i, j, index;
 
-		if (mom.length() != dad.length())
+		if (GA_CHECK(mom.length() != dad.length()))
 		{
 			GAErr(GA_LOC, mom.className(), "parial match cross",
 				  GAError::BadParentLength);
@@ -533,58 +576,17 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
-
-			sis.GAArray<T>::copy(mom);
-			for (i = a, index = a; i < b; i++, index++)
-			{
-				for (j = 0;
-					 j < sis.length() - 1 && sis.gene(j) != dad.gene(index);
-					 j++)
-					;
-				sis.swap(i, j);
-			}
-			bro.GAArray<T>::copy(dad);
-			for (i = a, index = a; i < b; i++, index++)
-			{
-				for (j = 0;
-					 j < bro.length() - 1 && bro.gene(j) != mom.gene(index);
-					 j++)
-					;
-				bro.swap(i, j);
-			}
-
+			GA1DArrayPartialMatch(*c1, mom, dad, a, b);
+			GA1DArrayPartialMatch(*c2, dad, mom, a, b);
 			nc = 2;
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis =
-				(c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)
-					: DYN_CAST(GA1DArrayGenome<T> &, *c2));
-
-			const GA1DArrayGenome<T> *parent1, *parent2;
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 			if (GARandomBit())
-			{
-				parent1 = &mom;
-				parent2 = &dad;
-			}
+				GA1DArrayPartialMatch(sis, mom, dad, a, b);
 			else
-			{
-				parent1 = &dad;
-				parent2 = &mom;
-			}
-
-			sis.GAArray<T>::copy(*parent1);
-			for (i = a, index = a; i < b; i++, index++)
-			{
-				for (j = 0; j < sis.length() - 1 &&
-							sis.gene(j) != parent2->gene(index);
-					 j++)
-					;
-				sis.swap(i, j);
-			}
-
+				GA1DArrayPartialMatch(sis, dad, mom, a, b);
 			nc = 1;
 		}
 
@@ -595,27 +597,33 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	// described in Goldberg's book.
 	//   Parents and children must be the same length.
 	//   We make sure that b will be greater than a.
-	//   This implementation isn't terribly smart.  For example, I do a linear
-	// search rather than caching and doing binary search or smarter hash
-	// tables.
 	//   First we copy the mother into the sister.  Then move the 'holes' into
-	//   the
-	// crossover section and maintain the ordering of the non-hole elements.
+	// the crossover section and maintain the ordering of the non-hole elements.
 	// Finally, put the 'holes' in the proper order within the crossover
 	// section. After we have done the sister, we do the brother.
+	//   For distinct integers we know where the holes are from a position
+	// table, and the result is simply the non-holes in order (starting after
+	// the crossover section) with the father's section in the middle, so we
+	// build that directly.
 	static int OrderCrossover(const GAGenome &p1, const GAGenome &p2, GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =	DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad = DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedOrderCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedOrderCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		int a = GARandomInt(0, mom.length());
 		int b = GARandomInt(0, mom.length());
 		if (b < a)
 			SWAP(a, b);
-		int i, j, index;
 
-		if (mom.length() != dad.length())
+		if (GA_CHECK(mom.length() != dad.length()))
 		{
 			GAErr(GA_LOC, mom.className(), "order cross", GAError::BadParentLength);
 			return nc;
@@ -623,136 +631,17 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 
 		if (c1 && c2)
 		{
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
-
-			// Copy the parent
-			sis.GAArray<T>::copy(mom);
-
-			// Move all the 'holes' into the crossover section
-			for (i = 0, index = b; i < sis.size(); i++, index++)
-			{
-				if (index >= sis.size())
-					index = 0;
-				if (GA1DArrayIsHole(sis, dad, index, a, b))
-					break;
-			}
-
-			for (; i < sis.size() - b + a; i++, index++)
-			{
-				if (index >= sis.size())
-					index = 0;
-				j = index;
-				do
-				{
-					j++;
-					if (j >= sis.size())
-						j = 0;
-				} while (GA1DArrayIsHole(sis, dad, j, a, b));
-				sis.swap(index, j);
-			}
-
-			// Now put the 'holes' in the proper order within the crossover
-			// section.
-			for (i = a; i < b; i++)
-			{
-				if (sis.gene(i) != dad.gene(i))
-				{
-					for (j = i + 1; j < b; j++)
-						if (sis.gene(j) == dad.gene(i))
-							sis.swap(i, j);
-				}
-			}
-
-			// Now do the other child
-			bro.GAArray<T>::copy(dad);
-
-			// Move all the 'holes' into the crossover section
-			for (i = 0, index = b; i < bro.size(); i++, index++)
-			{
-				if (index >= bro.size())
-					index = 0;
-				if (GA1DArrayIsHole(bro, mom, index, a, b))
-					break;
-			}
-
-			for (; i < bro.size() - b + a; i++, index++)
-			{
-				if (index >= bro.size())
-					index = 0;
-				j = index;
-				do
-				{
-					j++;
-					if (j >= bro.size())
-						j = 0;
-				} while (GA1DArrayIsHole(bro, mom, j, a, b));
-				bro.swap(index, j);
-			}
-
-			// Now put the 'holes' in the proper order within the crossover
-			// section.
-			for (i = a; i < b; i++)
-			{
-				if (bro.gene(i) != mom.gene(i))
-				{
-					for (j = i + 1; j < b; j++)
-						if (bro.gene(j) == mom.gene(i))
-							bro.swap(i, j);
-				}
-			}
-
+			GA1DArrayOrder(*c1, mom, dad, a, b);
+			GA1DArrayOrder(*c2, dad, mom, a, b);
 			nc = 2;
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis =
-				(c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1)
-					: DYN_CAST(GA1DArrayGenome<T> &, *c2));
-
-			const GA1DArrayGenome<T> *parent1, *parent2;
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 			if (GARandomBit())
-			{
-				parent1 = &mom;
-				parent2 = &dad;
-			}
+				GA1DArrayOrder(sis, mom, dad, a, b);
 			else
-			{
-				parent1 = &dad;
-				parent2 = &mom;
-			}
-
-			sis.GAArray<T>::copy(*parent1);
-			for (i = 0, index = b; i < sis.size(); i++, index++)
-			{
-				if (index >= sis.size())
-					index = 0;
-				if (GA1DArrayIsHole(sis, *parent2, index, a, b))
-					break;
-			}
-			for (; i < sis.size() - b + a; i++, index++)
-			{
-				if (index >= sis.size())
-					index = 0;
-				j = index;
-				do
-				{
-					j++;
-					if (j >= sis.size())
-						j = 0;
-				} while (GA1DArrayIsHole(sis, *parent2, j, a, b));
-				sis.swap(index, j);
-			}
-			for (i = a; i < b; i++)
-			{
-				if (sis.gene(i) != parent2->gene(i))
-				{
-					for (j = i + 1; j < b; j++)
-						if (sis.gene(j) == parent2->gene(i))
-							sis.swap(i, j);
-				}
-			}
-
+				GA1DArrayOrder(sis, dad, mom, a, b);
 			nc = 1;
 		}
 
@@ -761,34 +650,32 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 
 	// Cycle crossover for the 1D array genome.  This is implemented as
 	// described in goldberg's book.  The first is picked from mom, then cycle
-	// using dad. Finally, fill in the gaps with the elements from dad.
-	//   We allocate space for a temporary array in this routine.  It never
-	//   frees
-	// the memory that it uses, so you might want to re-think this if you're
-	// really memory-constrained (similar to what we do with the uniform
-	// crossover when the children are resizeable).
-	//  Allocate space for an array of flags.  We use this to keep track of
-	//  whether
-	// the child's contents came from the mother or the father.  We don't free
-	// the space here, but it is not a memory leak.
-	//   The first step is to cycle through mom & dad to get the cyclic part of
-	// the crossover.  Then fill in the rest of the sis with dad's contents that
-	// we didn't use in the cycle.  Finally, do the same thing for the other
-	// child.
+	// using dad. Finally, fill in the gaps with the elements from dad.  The
+	// brother is made the same way with the parents the other way around.
+	//   We keep a flag for each position to track whether the child's
+	// contents came from the mother or the father.  The flags (and the
+	// position table we use to follow the cycle when the elements are
+	// distinct integers) are kept from one call to the next, so you might
+	// want to re-think this if you're really memory-constrained.
 	//   Notice that this implementation makes serious use of the operator= for
-	//   the
-	// objects in the array.  It also requires the operator != and ==
+	// the objects in the array.  It also requires the operator != and ==
 	// comparators.
 	static int CycleCrossover(const GAGenome &p1, const GAGenome &p2,
 							  GAGenome *c1, GAGenome *c2)
 	{
-		const GA1DArrayGenome<T> &mom =	DYN_CAST(const GA1DArrayGenome<T> &, p1);
-		const GA1DArrayGenome<T> &dad =	DYN_CAST(const GA1DArrayGenome<T> &, p2);
+		return TypedCycleCrossover(DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
 
+	static int TypedCycleCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
 		int nc = 0;
-		int current = 0;
 
-		if (mom.length() != dad.length())
+		if (GA_CHECK(mom.length() != dad.length()))
 		{
 			GAErr(GA_LOC, mom.className(), "cycle cross", GAError::BadParentLength);
 			return nc;
@@ -796,100 +683,104 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 
 		if (c1 && c2)
 		{
-			GAMask mask;
-			GA1DArrayGenome<T> &sis = DYN_CAST(GA1DArrayGenome<T> &, *c1);
-			GA1DArrayGenome<T> &bro = DYN_CAST(GA1DArrayGenome<T> &, *c2);
-
-			mask.size(sis.length());
-			mask.clear();
-
-			sis.gene(0, mom.gene(0));
-			mask[0] = 1;
-			while (dad.gene(current) != mom.gene(0))
-			{
-				for (int i = 0; i < sis.size(); i++)
-				{
-					if (mom.gene(i) == dad.gene(current))
-					{
-						sis.gene(i, mom.gene(i));
-						mask[i] = 1;
-						current = i;
-						break;
-					}
-				}
-			}
-
-			for (int i = 0; i < sis.size(); i++)
-				if (mask[i] == 0)
-					sis.gene(i, dad.gene(i));
-
-			mask.clear();
-
-			bro.gene(0, dad.gene(0));
-			mask[0] = 1;
-			while (mom.gene(current) != dad.gene(0))
-			{
-				for (int i = 0; i < bro.size(); i++)
-				{
-					if (dad.gene(i) == mom.gene(current))
-					{
-						bro.gene(i, dad.gene(i));
-						mask[i] = 1;
-						current = i;
-						break;
-					}
-				}
-			}
-
-			for (int i = 0; i < bro.size(); i++)
-				if (mask[i] == 0)
-					bro.gene(i, mom.gene(i));
-
+			GA1DArrayCycle(*c1, mom, dad);
+			GA1DArrayCycle(*c2, dad, mom);
 			nc = 2;
 		}
 		else if (c1 || c2)
 		{
-			GA1DArrayGenome<T> &sis = (c1 ? DYN_CAST(GA1DArrayGenome<T> &, *c1) : DYN_CAST(GA1DArrayGenome<T> &, *c2));
-
-			const GA1DArrayGenome<T> *parent1, *parent2;
+			GA1DArrayGenome<T> &sis = (c1 ? *c1 : *c2);
 			if (GARandomBit())
-			{
-				parent1 = &mom;
-				parent2 = &dad;
-			}
+				GA1DArrayCycle(sis, mom, dad);
 			else
+				GA1DArrayCycle(sis, dad, mom);
+			nc = 1;
+		}
+
+		return nc;
+	}
+
+	// Edge recombination for integer genomes that are tours (see
+	// GAEdgeRecombination).  The children must be the same length as the
+	// parents.  For any other kind of element this posts an error.
+	static int EdgeRecombinationCrossover(const GAGenome &p1, const GAGenome &p2,
+										  GAGenome *c1, GAGenome *c2)
+	{
+		return TypedEdgeRecombinationCrossover(
+			DYN_CAST(const GA1DArrayGenome<T> &, p1),
+			DYN_CAST(const GA1DArrayGenome<T> &, p2),
+			DYN_CAST(GA1DArrayGenome<T> *, c1),
+			DYN_CAST(GA1DArrayGenome<T> *, c2));
+	}
+
+	static int TypedEdgeRecombinationCrossover(const GA1DArrayGenome<T> &mom,
+		const GA1DArrayGenome<T> &dad, GA1DArrayGenome<T> *c1,
+		GA1DArrayGenome<T> *c2)
+	{
+		int nc = 0;
+		int n = mom.length();
+		if constexpr (!std::is_integral<T>::value)
+		{
+			GAErr(GA_LOC, mom.className(), "edge recombination cross", GAError::OpUndef);
+			return nc;
+		}
+		else
+		{
+			if (GA_CHECK(dad.length() != n))
 			{
-				parent1 = &dad;
-				parent2 = &mom;
+				GAErr(GA_LOC, mom.className(), "edge recombination cross",
+					  GAError::BadParentLength);
+				return nc;
 			}
 
-			GAMask mask;
-			mask.size(sis.length());
-			mask.clear();
-
-			sis.gene(0, parent1->gene(0));
-			mask[0] = 1;
-			while (parent2->gene(current) != parent1->gene(0))
+			static thread_local std::vector<T> tour;
+			tour.resize(n);
+			const GA1DArrayGenome<T> *parent1 = &mom, *parent2 = &dad;
+			for (GA1DArrayGenome<T> *c : {c1, c2})
 			{
-				for (int i = 0; i < sis.size(); i++)
+				if (c)
 				{
-					if (parent1->gene(i) == parent2->gene(current))
+					if (GA_CHECK(c->length() != n))
 					{
-						sis.gene(i, parent1->gene(i));
-						mask[i] = 1;
-						current = i;
-						break;
+						GAErr(GA_LOC, mom.className(), "edge recombination cross",
+							  GAError::SameLengthReqd);
+						return nc;
+					}
+					if (!GAEdgeRecombination(parent1->a.data(), parent2->a.data(), n,
+											 tour.data()))
+					{
+						GAErr(GA_LOC, mom.className(), "edge recombination cross",
+							  GAError::BadTour);
+						return nc;
 					}
+					for (int i = 0; i < n; i++)
+						c->gene(i, tour[i]);
+					nc++;
 				}
+				std::swap(parent1, parent2);
 			}
-			for (int i = 0; i < sis.size(); i++)
-				if (mask[i] == 0)
-					sis.gene(i, parent2->gene(i));
-
-			nc = 1;
+			return nc;
 		}
+	}
 
-		return nc;
+	// The fraction of the edges of one tour that the other tour does not have
+	// (see GAEdgeDistance).  Unlike the element comparator, this is 0 for the
+	// same tour from a different starting town or in the other direction.
+	static float EdgeComparator(const GAGenome &a, const GAGenome &b)
+	{
+		const GA1DArrayGenome<T> &sis = DYN_CAST(const GA1DArrayGenome<T> &, a);
+		const GA1DArrayGenome<T> &bro = DYN_CAST(const GA1DArrayGenome<T> &, b);
+
+		if (sis.length() != bro.length())
+			return -1;
+		if (sis.length() == 0)
+			return 0;
+		if constexpr (std::is_integral<T>::value)
+			return STA_CAST(float, GAEdgeDistance(sis.a.data(), bro.a.data(),
+												  sis.length())) /
+				   sis.length();
+		else
+			return -1;
 	}
 
   public:
@@ -971,6 +862,7 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 			nx = c->nx;
 			minX = c->minX;
 			maxX = c->maxX;
+			_was = c->_was;
 		}
 	}
 
@@ -996,15 +888,62 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 		return ((this == &c) ? true	: ((nx != b.nx) ? 0 : GAArray<T>::equal(b, 0, 0, nx)));
 	}
 
+	// The built-in operators without the checks on the genome type.
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator f) const override
+	{
+		using Ops = GATypedOperators<GA1DArrayGenome<T>>;
+		if (f == SwapMutator)
+			return Ops::template mutator<TypedSwapMutator>;
+		return nullptr;
+	}
+
+	GAGenome::SexualCrossover uncheckedCrossover(GAGenome::SexualCrossover f) const override
+	{
+		using Ops = GATypedOperators<GA1DArrayGenome<T>>;
+		if (f == UniformCrossover)
+			return Ops::template crossover<TypedUniformCrossover>;
+		if (f == OnePointCrossover)
+			return Ops::template crossover<TypedOnePointCrossover>;
+		if (f == TwoPointCrossover)
+			return Ops::template crossover<TypedTwoPointCrossover>;
+		if (f == EvenOddCrossover)
+			return Ops::template crossover<TypedEvenOddCrossover>;
+		if (f == PartialMatchCrossover)
+			return Ops::template crossover<TypedPartialMatchCrossover>;
+		if (f == OrderCrossover)
+			return Ops::template crossover<TypedOrderCrossover>;
+		if (f == CycleCrossover)
+			return Ops::template crossover<TypedCycleCrossover>;
+		if (f == EdgeRecombinationCrossover)
+			return Ops::template crossover<TypedEdgeRecombinationCrossover>;
+		return nullptr;
+	}
+
 	const T &gene(unsigned int x = 0) const { return this->a[x]; }
 	T &gene(unsigned int x, const T &value)
 	{
 		if (this->a.at(x) != value)
 		{
-			this->a.at(x) = value;
-			_evaluated = false;
+			logged(x);
+			this->a[x] = value;
 		}
-		return this->a.at(x);
+		return this->a[x];
+	}
+	// The elements as one block, for the operators that write many of them at
+	// once.  Nothing is logged, so the next evaluation is a full one.
+	T *genes()
+	{
+		_evaluated = false;
+		_changes.clear();
+		return this->a.data();
+	}
+	const T *genes() const { return this->a.data(); }
+	// The value that element x had when the genome was last evaluated (for
+	// delta evaluators).
+	const T &previous(unsigned int x) const
+	{
+		int k = changeSlot(x);
+		return (k < 0 ? this->a[x] : _was[k]);
 	}
 	int length() const { return nx; }
 	int length(int x)
@@ -1095,14 +1034,29 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 	}
 	void swap(unsigned int i, unsigned int j)
 	{
+		if (i == j)
+			return;
+		logged(i);
+		logged(j);
 		GAArray<T>::swap(i, j);
-		_evaluated = false;
 	}
 
   protected:
 	unsigned int nx; // how long is the data string?
 	unsigned int minX; // what is the lower limit?
 	unsigned int maxX; // what is the upper limit?
+	std::vector<T> _was; // old value of each element in the change log
+
+	// Element x is about to change.  Keep its old value if the change is logged.
+	void logged(unsigned int x)
+	{
+		int k = logChange(x);
+		if (k >= 0)
+		{
+			_was.resize(k + 1);
+			_was[k] = this->a.at(x);
+		}
+	}
 
   private:
 	GA1DArrayGenome() : GAArray<T>(0) {}
@@ -1118,6 +1072,215 @@ template <class T> class GA1DArrayGenome : public GAArray<T>, public GAGenome
 				return 1;
 		return 0;
 	}
+
+	// Fill pos with the position of each element of c (element x is at
+	// pos[x-lo]).  This only works for distinct integers that are not spread
+	// out too thinly, so if the elements are anything else we return false and
+	// the crossovers search instead.
+	static bool GA1DArrayIndex(const GA1DArrayGenome<T> &c, std::vector<int> &pos,
+							   long long &lo)
+	{
+		if constexpr (std::is_integral<T>::value)
+		{
+			int n = c.length();
+			if (n == 0)
+				return false;
+			long long hi = lo = c.gene(0);
+			for (int i = 1; i < n; i++)
+			{
+				lo = std::min(lo, STA_CAST(long long, c.gene(i)));
+				hi = std::max(hi, STA_CAST(long long, c.gene(i)));
+			}
+			if (hi - lo >= 4LL * n + 64)
+				return false;
+			pos.assign(STA_CAST(std::size_t, hi - lo + 1), -1);
+			for (int i = 0; i < n; i++)
+			{
+				int &p = pos[STA_CAST(std::size_t, c.gene(i) - lo)];
+				if (p >= 0)
+					return false;
+				p = i;
+			}
+			return true;
+		}
+		else
+			return false;
+	}
+	static int GA1DArrayFind(const std::vector<int> &pos, long long lo, const T &x)
+	{
+		long long k = STA_CAST(long long, x) - lo;
+		return (k >= 0 && k < STA_CAST(long long, pos.size()) ? pos[k] : -1);
+	}
+
+	// Make c from p1, then swap in the contents of p2's section a..b.
+	static void GA1DArrayPartialMatch(GA1DArrayGenome<T> &c,
+									  const GA1DArrayGenome<T> &p1,
+									  const GA1DArrayGenome<T> &p2, int a, int b)
+	{
+		c.GAArray<T>::copy(p1);
+		c._evaluated = false;
+		int n = c.length();
+		if constexpr (std::is_integral<T>::value)
+		{
+			static thread_local std::vector<int> pos;
+			long long lo;
+			if (GA1DArrayIndex(c, pos, lo))
+			{
+				for (int i = a; i < b; i++)
+				{
+					int j = GA1DArrayFind(pos, lo, p2.gene(i));
+					if (j < 0)
+						j = n - 1; // where the search would have stopped
+					c.swap(i, j);
+					pos[c.gene(i) - lo] = i;
+					pos[c.gene(j) - lo] = j;
+				}
+				return;
+			}
+		}
+		for (int i = a; i < b; i++)
+		{
+			int j;
+			for (j = 0; j < n - 1 && c.gene(j) != p2.gene(i); j++)
+				;
+			c.swap(i, j);
+		}
+	}
+
+	// Make c from p1, move the holes (elements in p2's section a..b) into the
+	// section, then put them in p2's order.
+	static void GA1DArrayOrder(GA1DArrayGenome<T> &c, const GA1DArrayGenome<T> &p1,
+							   const GA1DArrayGenome<T> &p2, int a, int b)
+	{
+		c.GAArray<T>::copy(p1);
+		c._evaluated = false;
+		int n = c.size();
+		int i, j, index;
+		if constexpr (std::is_integral<T>::value)
+		{
+			static thread_local std::vector<int> pos;
+			static thread_local std::vector<char> hole;
+			static thread_local std::vector<T> old;
+			long long lo;
+			// The shortcut needs every element of p2's section to be in c
+			// exactly once, otherwise the number of holes is not the size of
+			// the section and the search does something else.
+			bool fits = GA1DArrayIndex(c, pos, lo);
+			if (fits)
+			{
+				hole.assign(n, 0);
+				for (i = a; i < b && fits; i++)
+				{
+					j = GA1DArrayFind(pos, lo, p2.gene(i));
+					fits = (j >= 0 && !hole[j]);
+					if (fits)
+						hole[j] = 1;
+				}
+			}
+			if (fits)
+			{
+				old.resize(n);
+				for (i = 0; i < n; i++)
+					old[i] = c.gene(i);
+				for (i = 0, j = b; i < n; i++)
+				{
+					index = (b + i) % n;
+					if (!hole[index])
+						c.gene((j++) % n, old[index]);
+				}
+				for (i = a; i < b; i++)
+					c.gene(i, p2.gene(i));
+				return;
+			}
+		}
+
+		// Move all the 'holes' into the crossover section
+		for (i = 0, index = b; i < n; i++, index++)
+		{
+			if (index >= n)
+				index = 0;
+			if (GA1DArrayIsHole(c, p2, index, a, b))
+				break;
+		}
+		for (; i < n - b + a; i++, index++)
+		{
+			if (index >= n)
+				index = 0;
+			j = index;
+			do
+			{
+				j++;
+				if (j >= n)
+					j = 0;
+			} while (GA1DArrayIsHole(c, p2, j, a, b));
+			c.swap(index, j);
+		}
+
+		// Now put the 'holes' in the proper order within the crossover
+		// section.
+		for (i = a; i < b; i++)
+		{
+			if (c.gene(i) != p2.gene(i))
+			{
+				for (j = i + 1; j < b; j++)
+					if (c.gene(j) == p2.gene(i))
+						c.swap(i, j);
+			}
+		}
+	}
+
+	// Take the cycle through position 0 from p1 and the rest from p2.  If p2
+	// is not a permutation of p1 the cycle may not close, so we also stop when
+	// we cannot find the next element or come back to one we already took.
+	static void GA1DArrayCycle(GA1DArrayGenome<T> &c, const GA1DArrayGenome<T> &p1,
+							   const GA1DArrayGenome<T> &p2)
+	{
+		static thread_local std::vector<char> mask;
+		int n = c.size();
+		if (n == 0)
+			return;
+		mask.assign(n, 0);
+		c.gene(0, p1.gene(0));
+		mask[0] = 1;
+
+		int current = 0;
+		bool indexed = false;
+		if constexpr (std::is_integral<T>::value)
+		{
+			static thread_local std::vector<int> pos;
+			long long lo;
+			if ((indexed = GA1DArrayIndex(p1, pos, lo)))
+			{
+				while (p2.gene(current) != p1.gene(0))
+				{
+					int i = GA1DArrayFind(pos, lo, p2.gene(current));
+					if (i < 0 || mask[i])
+						break;
+					c.gene(i, p1.gene(i));
+					mask[i] = 1;
+					current = i;
+				}
+			}
+		}
+		if (!indexed)
+		{
+			while (p2.gene(current) != p1.gene(0))
+			{
+				int i;
+				for (i = 0; i < n && p1.gene(i) != p2.gene(current); i++)
+					;
+				if (i == n || mask[i])
+					break;
+				c.gene(i, p1.gene(i));
+				mask[i] = 1;
+				current = i;
+			}
+		}
+
+		for (int i = 0; i < n; i++)
+			if (mask[i] == 0)
+				c.gene(i, p2.gene(i));
+	}
 };
 
 /* ----------------------------------------------------------------------------
@@ -1148,7 +1311,9 @@ link to our allele set (so we don't end up with zillions of allele sets).  Same
 is true for the copy constructor.
   The array may have a single allele set or an array of allele sets, depending
 on which creator was called.  Either way, the allele set cannot be changed
-once the array is created.
+once the array is created.  The genome lays its allele sets out in an allele
+table (see GAAllele.h) for the initializers and mutators, and its copies and
+clones share that table.
 ---------------------------------------------------------------------------- */
 
 template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
@@ -1165,8 +1330,9 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	{
 		GA1DArrayAlleleGenome<T> &child = DYN_CAST(GA1DArrayAlleleGenome<T> &, c);
 		child.resize(GAGenome::ANY_SIZE); // let chrom resize if it can
+		const GAAlleleTable<T> &alleles = child.alleles();
 		for (int i = child.length() - 1; i >= 0; i--)
-			child.gene(i, child.alleleset(i).allele());
+			child.gene(i, alleles.random(i));
 	}
 
 	// Random initializer for order-based genome.  Loop through the genome
@@ -1194,11 +1360,15 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	// of allele sets for a given array.
 	static int FlipMutator(GAGenome &c, float pmut)
 	{
-		GA1DArrayAlleleGenome<T> &child = DYN_CAST(GA1DArrayAlleleGenome<T> &, c);
+		return TypedFlipMutator(DYN_CAST(GA1DArrayAlleleGenome<T> &, c), pmut);
+	}
 
+	static int TypedFlipMutator(GA1DArrayAlleleGenome<T> &child, float pmut)
+	{
 		if (pmut <= 0.0)
 			return (0);
 
+		const GAAlleleTable<T> &alleles = child.alleles();
 		float nMut = pmut * STA_CAST(float, child.length());
 		if (nMut < 1.0)
 		{ // we have to do a flip test on each bit
@@ -1207,7 +1377,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 			{
 				if (GAFlipCoin(pmut))
 				{
-					child.gene(i, child.alleleset(i).allele());
+					child.gene(i, alleles.random(i));
 					nMut++;
 				}
 			}
@@ -1217,7 +1387,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 			for (int n = 0; n < nMut; n++)
 			{
 				int i = GARandomInt(0, child.length() - 1);
-				child.gene(i, child.alleleset(i).allele());
+				child.gene(i, alleles.random(i));
 			}
 		}
 		return (STA_CAST(int, nMut));
@@ -1230,6 +1400,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 		aset(std::vector<GAAlleleSet<T>>(1))
 	{		
 		aset.at(0) = s;
+		table = std::make_shared<const GAAlleleTable<T>>(aset);
 
 		this->initializer(GA1DArrayAlleleGenome<T>::DEFAULT_1DARRAY_ALLELE_INITIALIZER);
 		this->mutator(GA1DArrayAlleleGenome<T>::DEFAULT_1DARRAY_ALLELE_MUTATOR);
@@ -1243,6 +1414,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	{
 		for (int i = 0; i < size(); i++)
 			aset.at(i) = sa.set(i);
+		table = std::make_shared<const GAAlleleTable<T>>(aset);
 
 		this->initializer(
 			GA1DArrayAlleleGenome<T>::DEFAULT_1DARRAY_ALLELE_INITIALIZER);
@@ -1271,7 +1443,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 	}
 
 	// Delete the allele set
-	~GA1DArrayAlleleGenome() override { delete[] aset; }
+	~GA1DArrayAlleleGenome() override {}
 
 	// This implementation of clone does not make use of the contents/attributes
 	// capability because this whole interface isn't quite right yet...  Just
@@ -1299,6 +1471,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 			{
 				aset.at(i).link(c->aset.at(i));
 			}
+			table = c->table;
 		}
 	}
 
@@ -1315,6 +1488,20 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 		return GA1DArrayGenome<T>::equal(c);
 	}
 
+	// The built-in operators without the checks on the genome type.
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator f) const override
+	{
+		using Ops = GATypedOperators<GA1DArrayAlleleGenome<T>>;
+		if (f == FlipMutator)
+			return Ops::template mutator<TypedFlipMutator>;
+		return GA1DArrayGenome<T>::uncheckedMutator(f);
+	}
+	GAGenome::SexualCrossover
+	uncheckedCrossover(GAGenome::SexualCrossover f) const override
+	{
+		return GA1DArrayGenome<T>::uncheckedCrossover(f);
+	}
+
 	// If we resize to a larger length then we need to set the contents to a
 	// valid value (ie one of our alleles).
 	int resize(int len) override
@@ -1324,7 +1511,7 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 		if (this->nx > oldx)
 		{
 			for (unsigned int i = oldx; i < this->nx; i++)
-				this->a.at(i) = aset.at(i % size()).allele();
+				this->a.at(i) = table->random(i);
 		}
 		return len;
 	}
@@ -1336,9 +1523,13 @@ template <class T> class GA1DArrayAlleleGenome : public GA1DArrayGenome<T>
 
 	int size() const { return aset.size(); }
 
+	// The allele sets laid out flat for the operators (see GAAllele.h).
+	const GAAlleleTable<T> &alleles() const { return *table; }
+
   protected:
 	// the allele set(s) for this genome
 	std::vector<GAAlleleSet<T>> aset; 
+	std::shared_ptr<const GAAlleleTable<T>> table; // shared by the copies
 };
 
 #endif
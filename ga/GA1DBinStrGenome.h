@@ -33,6 +33,17 @@ copy
   genome to fit the copy.  You'll have to do resizes before you call this
   routine if you want the copy to fit the original.
 
+previous
+	Return the value that bit x had when the genome was last evaluated.  This
+  is for delta evaluators:  the bits that changed are in the change log, all
+  of the others are what they were.
+
+BitEmbedding
+	Write the bits of the genome (0 or 1) as the coordinates of a point, one
+  for each bit.  With the HAMMING metric the distance between two points is
+  what BitComparator returns, so the niching schemes use this on their own
+  for genomes that use BitComparator (see GAScaling.h).
+
 ==, !=
 	Are two genomes equal?  Our test for equality is based upon the
   contents of the genome, NOT the behaviour.  So as long as the bitstreams
@@ -55,6 +66,20 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 	static int OnePointCrossover(const GAGenome &, const GAGenome &, GAGenome *, GAGenome *);
 	static int TwoPointCrossover(const GAGenome &, const GAGenome &, GAGenome *, GAGenome *);
 	static float BitComparator(const GAGenome &, const GAGenome &);
+	static void BitEmbedding(const GAGenome &, float *);
+	static int TypedFlipMutator(GA1DBinaryStringGenome &, float);
+	static int TypedUniformCrossover(const GA1DBinaryStringGenome &,
+		const GA1DBinaryStringGenome &, GA1DBinaryStringGenome *,
+		GA1DBinaryStringGenome *);
+	static int TypedEvenOddCrossover(const GA1DBinaryStringGenome &,
+		const GA1DBinaryStringGenome &, GA1DBinaryStringGenome *,
+		GA1DBinaryStringGenome *);
+	static int TypedOnePointCrossover(const GA1DBinaryStringGenome &,
+		const GA1DBinaryStringGenome &, GA1DBinaryStringGenome *,
+		GA1DBinaryStringGenome *);
+	static int TypedTwoPointCrossover(const GA1DBinaryStringGenome &,
+		const GA1DBinaryStringGenome &, GA1DBinaryStringGenome *,
+		GA1DBinaryStringGenome *);
 
   public:
 	explicit GA1DBinaryStringGenome(unsigned int len, GAGenome::Evaluator f = nullptr, void *u = nullptr);
@@ -88,12 +113,26 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 	int write(std::ostream &os) const override;
 
 	bool equal(const GAGenome &c) const override;
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator) const override;
+	GAGenome::SexualCrossover uncheckedCrossover(GAGenome::SexualCrossover) const override;
 
 	short gene(unsigned int x = 0) const { return bit(x); }
 	short gene(unsigned int x, short value)
 	{
-		_evaluated = false;
-		return ((bit(x) == value) ? value : bit(x, value));
+		if (bit(x) == value)
+			return value;
+		int k = logChange(x);
+		if (k >= 0)
+		{
+			_was.resize(k + 1);
+			_was[k] = bit(x);
+		}
+		return bit(x, value);
+	}
+	short previous(unsigned int x) const
+	{
+		int k = changeSlot(x);
+		return (k < 0 ? bit(x) : _was[k]);
 	}
 	short operator[](unsigned int x) { return gene(x); }
 	int length() const { return nx; }
@@ -119,6 +158,7 @@ class GA1DBinaryStringGenome : public GABinaryString, public GAGenome
 	unsigned int nx; // how long is the data string?
 	unsigned int minX; // what is the lower limit?
 	unsigned int maxX; // what is the upper limit?
+	std::vector<short> _was; // old value of each bit in the change log
 };
 
 inline void GA1DBinaryStringGenome::copy(const GA1DBinaryStringGenome &orig,
@@ -31,8 +31,11 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 
 	static int SwapMutator(GAGenome &c, float pmut)
 	{
-		GA2DArrayGenome<T> &child = DYN_CAST(GA2DArrayGenome<T> &, c);
+		return TypedSwapMutator(DYN_CAST(GA2DArrayGenome<T> &, c), pmut);
+	}
 
+	static int TypedSwapMutator(GA2DArrayGenome<T> &child, float pmut)
+	{
 		if (pmut <= 0.0)
 			return (0);
 
@@ -77,18 +80,23 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 	static int UniformCrossover(const GAGenome &p1, const GAGenome &p2,
 								GAGenome *c1, GAGenome *c2)
 	{
-		const GA2DArrayGenome<T> &mom =
-			DYN_CAST(const GA2DArrayGenome<T> &, p1);
-		const GA2DArrayGenome<T> &dad =
-			DYN_CAST(const GA2DArrayGenome<T> &, p2);
+		return TypedUniformCrossover(DYN_CAST(const GA2DArrayGenome<T> &, p1),
+			DYN_CAST(const GA2DArrayGenome<T> &, p2),
+			DYN_CAST(GA2DArrayGenome<T> *, c1),
+			DYN_CAST(GA2DArrayGenome<T> *, c2));
+	}
 
+	static int TypedUniformCrossover(const GA2DArrayGenome<T> &mom,
+		const GA2DArrayGenome<T> &dad, GA2DArrayGenome<T> *c1,
+		GA2DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		int i, j;
 
 		if (c1 && c2)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
-			GA2DArrayGenome<T> &bro = DYN_CAST(GA2DArrayGenome<T> &, *c2);
+			GA2DArrayGenome<T> &sis = *c1;
+			GA2DArrayGenome<T> &bro = *c2;
 
 			if (sis.width() == bro.width() && sis.height() == bro.height() &&
 				mom.width() == dad.width() && mom.height() == dad.height() &&
@@ -147,7 +155,7 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
+			GA2DArrayGenome<T> &sis = *c1;
 
 			if (mom.width() == dad.width() && mom.height() == dad.height() &&
 				sis.width() == mom.width() && sis.height() == mom.height())
@@ -185,11 +193,16 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 	static int OnePointCrossover(const GAGenome &p1, const GAGenome &p2,
 								 GAGenome *c1, GAGenome *c2)
 	{
-		const GA2DArrayGenome<T> &mom =
-			DYN_CAST(const GA2DArrayGenome<T> &, p1);
-		const GA2DArrayGenome<T> &dad =
-			DYN_CAST(const GA2DArrayGenome<T> &, p2);
+		return TypedOnePointCrossover(DYN_CAST(const GA2DArrayGenome<T> &, p1),
+			DYN_CAST(const GA2DArrayGenome<T> &, p2),
+			DYN_CAST(GA2DArrayGenome<T> *, c1),
+			DYN_CAST(GA2DArrayGenome<T> *, c2));
+	}
 
+	static int TypedOnePointCrossover(const GA2DArrayGenome<T> &mom,
+		const GA2DArrayGenome<T> &dad, GA2DArrayGenome<T> *c1,
+		GA2DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		unsigned int momsitex, momlenx, momsitey, momleny;
 		unsigned int dadsitex, dadlenx, dadsitey, dadleny;
@@ -197,14 +210,14 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 
 		if (c1 && c2)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
-			GA2DArrayGenome<T> &bro = DYN_CAST(GA2DArrayGenome<T> &, *c2);
+			GA2DArrayGenome<T> &sis = *c1;
+			GA2DArrayGenome<T> &bro = *c2;
 
 			if (sis.resizeBehaviour(Dimension::WIDTH) == GAGenome::FIXED_SIZE &&
 				bro.resizeBehaviour(Dimension::WIDTH) == GAGenome::FIXED_SIZE)
 			{
-				if (mom.width() != dad.width() || sis.width() != bro.width() ||
-					sis.width() != mom.width())
+				if (GA_CHECK(mom.width() != dad.width() || sis.width() != bro.width() ||
+							 sis.width() != mom.width()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -236,9 +249,9 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 					GAGenome::FIXED_SIZE &&
 				bro.resizeBehaviour(Dimension::HEIGHT) == GAGenome::FIXED_SIZE)
 			{
-				if (mom.height() != dad.height() ||
-					sis.height() != bro.height() ||
-					sis.height() != mom.height())
+				if (GA_CHECK(mom.height() != dad.height() ||
+							 sis.height() != bro.height() ||
+							 sis.height() != mom.height()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -285,11 +298,11 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
+			GA2DArrayGenome<T> &sis = *c1;
 
 			if (sis.resizeBehaviour(Dimension::WIDTH) == GAGenome::FIXED_SIZE)
 			{
-				if (mom.width() != dad.width() || sis.width() != mom.width())
+				if (GA_CHECK(mom.width() != dad.width() || sis.width() != mom.width()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -310,8 +323,8 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 
 			if (sis.resizeBehaviour(Dimension::HEIGHT) == GAGenome::FIXED_SIZE)
 			{
-				if (mom.height() != dad.height() ||
-					sis.height() != mom.height())
+				if (GA_CHECK(mom.height() != dad.height() ||
+							 sis.height() != mom.height()))
 				{
 					GAErr(GA_LOC, mom.className(), "one-point cross",
 						  GAError::SameLengthReqd);
@@ -362,18 +375,23 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 	static int EvenOddCrossover(const GAGenome &p1, const GAGenome &p2,
 								GAGenome *c1, GAGenome *c2)
 	{
-		const GA2DArrayGenome<T> &mom =
-			DYN_CAST(const GA2DArrayGenome<T> &, p1);
-		const GA2DArrayGenome<T> &dad =
-			DYN_CAST(const GA2DArrayGenome<T> &, p2);
+		return TypedEvenOddCrossover(DYN_CAST(const GA2DArrayGenome<T> &, p1),
+			DYN_CAST(const GA2DArrayGenome<T> &, p2),
+			DYN_CAST(GA2DArrayGenome<T> *, c1),
+			DYN_CAST(GA2DArrayGenome<T> *, c2));
+	}
 
+	static int TypedEvenOddCrossover(const GA2DArrayGenome<T> &mom,
+		const GA2DArrayGenome<T> &dad, GA2DArrayGenome<T> *c1,
+		GA2DArrayGenome<T> *c2)
+	{
 		int nc = 0;
 		int i, j;
 
 		if (c1 && c2)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
-			GA2DArrayGenome<T> &bro = DYN_CAST(GA2DArrayGenome<T> &, *c2);
+			GA2DArrayGenome<T> &sis = *c1;
+			GA2DArrayGenome<T> &bro = *c2;
 
 			if (sis.width() == bro.width() && sis.height() == bro.height() &&
 				mom.width() == dad.width() && mom.height() == dad.height() &&
@@ -423,7 +441,7 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		}
 		else if (c1)
 		{
-			GA2DArrayGenome<T> &sis = DYN_CAST(GA2DArrayGenome<T> &, *c1);
+			GA2DArrayGenome<T> &sis = *c1;
 
 			if (mom.width() == dad.width() && mom.height() == dad.height() &&
 				sis.width() == mom.width() && sis.height() == mom.height())
@@ -637,6 +655,27 @@ template <class T> class GA2DArrayGenome : public GAArray<T>, public GAGenome
 		return (val ? false : true);
 	}
 
+	// The built-in operators without the checks on the genome type.
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator f) const override
+	{
+		using Ops = GATypedOperators<GA2DArrayGenome<T>>;
+		if (f == SwapMutator)
+			return Ops::template mutator<TypedSwapMutator>;
+		return nullptr;
+	}
+
+	GAGenome::SexualCrossover uncheckedCrossover(GAGenome::SexualCrossover f) const override
+	{
+		using Ops = GATypedOperators<GA2DArrayGenome<T>>;
+		if (f == UniformCrossover)
+			return Ops::template crossover<TypedUniformCrossover>;
+		if (f == OnePointCrossover)
+			return Ops::template crossover<TypedOnePointCrossover>;
+		if (f == EvenOddCrossover)
+			return Ops::template crossover<TypedEvenOddCrossover>;
+		return nullptr;
+	}
+
 	const T &gene(unsigned int x, unsigned int y) const
 	{
 		return this->a[y * nx + x];
@@ -759,9 +798,11 @@ template <class T> class GA2DArrayAlleleGenome : public GA2DArrayGenome<T>
 
 	static int FlipMutator(GAGenome &c, float pmut)
 	{
-		GA2DArrayAlleleGenome<T> &child =
-			DYN_CAST(GA2DArrayAlleleGenome<T> &, c);
+		return TypedFlipMutator(DYN_CAST(GA2DArrayAlleleGenome<T> &, c), pmut);
+	}
 
+	static int TypedFlipMutator(GA2DArrayAlleleGenome<T> &child, float pmut)
+	{
 		if (pmut <= 0.0)
 			return (0);
 
@@ -880,6 +921,15 @@ template <class T> class GA2DArrayAlleleGenome : public GA2DArrayGenome<T>
 		return GA2DArrayGenome<T>::equal(c);
 	}
 
+	// The built-in operators without the checks on the genome type.
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator f) const override
+	{
+		using Ops = GATypedOperators<GA2DArrayAlleleGenome<T>>;
+		if (f == FlipMutator)
+			return Ops::template mutator<TypedFlipMutator>;
+		return GA2DArrayGenome<T>::uncheckedMutator(f);
+	}
+
 	int resize(int x, int y) override
 	{
 		unsigned int oldx = this->nx;
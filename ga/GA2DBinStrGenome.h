@@ -35,6 +35,16 @@ class GA2DBinaryStringGenome : public GABinaryString, public GAGenome
 								GAGenome *);
 	static int OnePointCrossover(const GAGenome &, const GAGenome &, GAGenome *,
 								 GAGenome *);
+	static int TypedFlipMutator(GA2DBinaryStringGenome &, float);
+	static int TypedUniformCrossover(const GA2DBinaryStringGenome &,
+		const GA2DBinaryStringGenome &, GA2DBinaryStringGenome *,
+		GA2DBinaryStringGenome *);
+	static int TypedEvenOddCrossover(const GA2DBinaryStringGenome &,
+		const GA2DBinaryStringGenome &, GA2DBinaryStringGenome *,
+		GA2DBinaryStringGenome *);
+	static int TypedOnePointCrossover(const GA2DBinaryStringGenome &,
+		const GA2DBinaryStringGenome &, GA2DBinaryStringGenome *,
+		GA2DBinaryStringGenome *);
 
   public:
 	GA2DBinaryStringGenome(unsigned int x, unsigned int y,
@@ -76,6 +86,8 @@ class GA2DBinaryStringGenome : public GABinaryString, public GAGenome
 	int write(std::ostream &) const override;
 
 	bool equal(const GAGenome &c) const override;
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator) const override;
+	GAGenome::SexualCrossover uncheckedCrossover(GAGenome::SexualCrossover) const override;
 
 	// specific to this class
 	short gene(unsigned int x, unsigned int y) const { return bit(x + nx * y); }
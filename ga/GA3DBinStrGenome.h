@@ -34,6 +34,16 @@ class GA3DBinaryStringGenome : public GABinaryString, public GAGenome
 								GAGenome *);
 	static int OnePointCrossover(const GAGenome &, const GAGenome &, GAGenome *,
 								 GAGenome *);
+	static int TypedFlipMutator(GA3DBinaryStringGenome &, float);
+	static int TypedUniformCrossover(const GA3DBinaryStringGenome &,
+		const GA3DBinaryStringGenome &, GA3DBinaryStringGenome *,
+		GA3DBinaryStringGenome *);
+	static int TypedEvenOddCrossover(const GA3DBinaryStringGenome &,
+		const GA3DBinaryStringGenome &, GA3DBinaryStringGenome *,
+		GA3DBinaryStringGenome *);
+	static int TypedOnePointCrossover(const GA3DBinaryStringGenome &,
+		const GA3DBinaryStringGenome &, GA3DBinaryStringGenome *,
+		GA3DBinaryStringGenome *);
 
   public:
 	GA3DBinaryStringGenome(unsigned int x, unsigned int y, unsigned int z,
@@ -81,6 +91,8 @@ class GA3DBinaryStringGenome : public GABinaryString, public GAGenome
 	int write(std::ostream &) const override;
 
 	bool equal(const GAGenome &c) const override;
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator) const override;
+	GAGenome::SexualCrossover uncheckedCrossover(GAGenome::SexualCrossover) const override;
 
 	// specific to this class
 	short gene(unsigned int x, unsigned int y, unsigned int z) const
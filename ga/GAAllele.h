@@ -17,6 +17,7 @@ imply the specific implementation of the container class).
 #include <garandom.h>
 
 #include <GAAllele.h>
+#include <atomic>
 #include <cstring>
 #include <gaerror.h>
 #include <istream>
@@ -183,7 +184,7 @@ template <class T> class GAAlleleSetCore
 
 	GAAllele::Type type{GAAllele::Type::ENUMERATED}; // is this an ennumerated or bounded set?
 	GAAllele::BoundType lowerb, upperb; // what kind of limit is the bound?
-	unsigned int cnt; // how many objects are using us?
+	std::atomic<unsigned int> cnt; // how many objects are using us?
 	unsigned int csz; // how big are the chunks to allocate?
 	unsigned int sz{0}; // number we have
 	unsigned int SZ{0}; // how many have we allocated?
@@ -218,8 +219,7 @@ template <class T> class GAAlleleSet
 	{
 		if (core != nullptr)
 		{
-			core->cnt -= 1;
-			if (core->cnt == 0)
+			if (--core->cnt == 0)
 			{
 				delete core;
 			}
@@ -252,8 +252,7 @@ template <class T> class GAAlleleSet
 		{
 			if (core != nullptr)
 			{
-				core->cnt -= 1;
-				if (core->cnt == 0)
+				if (--core->cnt == 0)
 					delete core;
 			}
 			core = set.core;
@@ -267,8 +266,10 @@ template <class T> class GAAlleleSet
 			return; // nothing to unlink
 		if (core->cnt > 1)
 		{
-			core->cnt -= 1;
-			core = new GAAlleleSetCore<T>(*core);
+			auto *c = new GAAlleleSetCore<T>(*core);
+			if (--core->cnt == 0)
+				delete core;
+			core = c;
 		}
 	}
 
@@ -538,6 +539,108 @@ template <class T> class GAAlleleSetArray
 	GAAlleleSet<T> **aset;
 };
 
+/* ----------------------------------------------------------------------------
+  The allele table is the allele sets of a genome laid out flat, one row per
+set, with each property in an array of its own:  the type, the bounds and
+their types, the increment, and where the values of an enumerated set start
+in one array of all of the enumerated values.  The genome operators that look
+at the allele set of each element (the initializers and mutators) read the
+row straight out of these arrays instead of going through the set and its core
+for every element.
+  Element i uses row i modulo the number of rows, just as the genomes pick
+their allele sets.  A table does not change once it is made, so a genome makes
+one when it is created and its copies and clones share it.
+
+random
+  A random allele for element i.  The table picks enumerated alleles itself;
+  it leaves the other types to the allele set (which knows how to pick them
+  for its type, see the real genome), so either way it uses the same random
+  numbers as the allele set does.
+
+all
+  Whether the set of every row is of the given type.
+---------------------------------------------------------------------------- */
+template <class T> class GAAlleleTable
+{
+  public:
+	explicit GAAlleleTable(const std::vector<GAAlleleSet<T>> &s)
+		: nrows(s.size())
+	{
+		sets.reserve(nrows);
+		for (const GAAlleleSet<T> &set : s)
+		{
+			sets.emplace_back();
+			sets.back().link(set);
+			types.push_back(set.type());
+			lowerb.push_back(set.lowerBoundType());
+			upperb.push_back(set.upperBoundType());
+			first.push_back(values.size());
+			if (set.type() == GAAllele::Type::ENUMERATED)
+			{
+				count.push_back(set.size());
+				for (int k = 0; k < set.size(); k++)
+					values.push_back(set.allele(k));
+				lo.push_back(T());
+				hi.push_back(T());
+			}
+			else
+			{
+				count.push_back(0);
+				lo.push_back(set.lower());
+				hi.push_back(set.upper());
+			}
+			step.push_back(set.type() == GAAllele::Type::DISCRETIZED ? set.inc()
+																	 : T());
+		}
+	}
+
+	int size() const { return nrows; }
+	const GAAlleleSet<T> &set(unsigned int i) const { return sets[row(i)]; }
+
+	GAAllele::Type type(unsigned int i) const { return types[row(i)]; }
+	const T &lower(unsigned int i) const { return lo[row(i)]; }
+	const T &upper(unsigned int i) const { return hi[row(i)]; }
+	const T &inc(unsigned int i) const { return step[row(i)]; }
+	GAAllele::BoundType lowerBoundType(unsigned int i) const
+	{
+		return lowerb[row(i)];
+	}
+	GAAllele::BoundType upperBoundType(unsigned int i) const
+	{
+		return upperb[row(i)];
+	}
+
+	bool all(GAAllele::Type t) const
+	{
+		for (GAAllele::Type u : types)
+			if (u != t)
+				return false;
+		return true;
+	}
+
+	T random(unsigned int i) const
+	{
+		unsigned int r = row(i);
+		if (types[r] == GAAllele::Type::ENUMERATED && count[r] > 0)
+			return values[first[r] + GARandomInt(0, count[r] - 1)];
+		return sets[r].allele();
+	}
+
+  protected:
+	unsigned int nrows;
+	std::vector<GAAlleleSet<T>> sets; // linked to the sets of the genome
+	std::vector<GAAllele::Type> types;
+	std::vector<GAAllele::BoundType> lowerb, upperb;
+	std::vector<T> lo, hi, step;
+	std::vector<unsigned int> first, count; // where the values of each row are
+	std::vector<T> values; // the alleles of all of the enumerated sets
+
+	unsigned int row(unsigned int i) const
+	{
+		return (nrows == 1 ? 0 : i % nrows);
+	}
+};
+
 // could do these with a memcmp if the type is simple...
 template <class T>
 int operator==(const GAAlleleSet<T>& a, const GAAlleleSet<T>& b)
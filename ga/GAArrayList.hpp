@@ -0,0 +1,244 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  arraylist.h
+
+ DESCRIPTION:
+  This defines the array list:  the interface of the list on top of an array.
+---------------------------------------------------------------------------- */
+#ifndef _ga_arraylist_h_
+#define _ga_arraylist_h_
+
+#include <GAListBASE.h>
+#include <gaerror.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+/* ----------------------------------------------------------------------------
+ GAArrayList
+-------------------------------------------------------------------------------
+  The array list has the same members as GAList, including the embedded
+iterator, but it keeps the elements in one array instead of a ring of nodes.
+It is meant for order-based problems (tours, schedules) where the elements are
+the distinct integers 0, 1, 2, ...  For those it also keeps an index from each
+element to its position, so finding an element is a lookup instead of a walk
+through the list.
+  The iterator behaves like the list iterator:  next and prev wrap around at
+the ends, a warp to a position that does not exist leaves the iterator at the
+head, and a swap moves the iterator along with the element it was on.  Because
+the elements are in an array, warp and swap take constant time.  Inserting or
+removing anywhere but at the tail moves the elements behind it.
+  The elements must be integers that are not negative (the size of the index
+is the largest element plus one).
+
+position
+  Return the position of the specified element, or -1 if it is not in the
+  list.  If there is more than one, you get one of them.  The index is rebuilt
+  when you ask for a position after an insertion or removal.  Swaps keep it up
+  to date.
+
+contents
+  Return the elements in order.  An objective can walk this array rather than
+  use the iterator.
+---------------------------------------------------------------------------- */
+template <class T> class GAArrayList
+{
+	static_assert(std::is_integral<T>::value,
+				  "the elements of an array list must be integers");
+
+  public:
+	GAArrayList() = default;
+	explicit GAArrayList(const T &t) : data(1, t), cur(0) {}
+	GAArrayList(const GAArrayList<T> &orig) { copy(orig); }
+	GAArrayList<T> &operator=(const GAArrayList<T> &orig)
+	{
+		if (&orig != this)
+			copy(orig);
+		return *this;
+	}
+	virtual ~GAArrayList() = default;
+
+	// Clone the list from element i to the end.
+	GAArrayList<T> *clone(unsigned int i = 0) const
+	{
+		auto *t = new GAArrayList<T>;
+		if (i < data.size())
+		{
+			t->data.assign(data.begin() + i, data.end());
+			t->cur = 0;
+		}
+		return t;
+	}
+
+	// Like the list, the iterator goes back to the head.
+	void copy(const GAArrayList<T> &orig)
+	{
+		data = orig.data;
+		cur = (data.empty() ? -1 : 0);
+		cpos = orig.cpos;
+		if (cpos == 0)
+			pos = orig.pos;
+	}
+
+	int size() const { return STA_CAST(int, data.size()); }
+	const std::vector<T> &contents() const { return data; }
+	int position(const T &t) const
+	{
+		if (cpos)
+			index();
+		return (STA_CAST(long long, t) >= 0 && STA_CAST(std::size_t, t) < pos.size()
+					? pos[t]
+					: -1);
+	}
+
+	// Destroy the current element.  The iterator goes to the previous element,
+	// or to the new head if we destroyed the head.
+	int destroy()
+	{
+		if (cur < 0)
+			return GAListBASE::NO_ERR;
+		erase(cur);
+		if (data.empty())
+			cur = -1;
+		else if (cur > 0)
+			cur--;
+		return GAListBASE::NO_ERR;
+	}
+
+	int swap(unsigned int a, unsigned int b)
+	{
+		if (a == b || a >= data.size() || b >= data.size())
+			return GAListBASE::NO_ERR;
+		std::swap(data[a], data[b]);
+		if (cpos == 0)
+		{
+			pos[data[a]] = a;
+			pos[data[b]] = b;
+		}
+		if (cur == STA_CAST(int, a))
+			cur = b;
+		else if (cur == STA_CAST(int, b))
+			cur = a;
+		return GAListBASE::NO_ERR;
+	}
+
+	// Remove the current element and return a copy of it.  The iterator goes
+	// to the previous element (the tail if we removed the head).
+	T *remove()
+	{
+		if (cur < 0)
+			return nullptr;
+		T *contents = new T(data[cur]);
+		erase(cur);
+		if (data.empty())
+			cur = -1;
+		else
+			cur = (cur > 0 ? cur - 1 : size() - 1);
+		return contents;
+	}
+
+	int insert(GAArrayList<T> *t, GAListBASE::Location where = GAListBASE::AFTER)
+	{
+		if (this == t)
+		{
+			GAErr(GA_LOC, "GAArrayList", "insert", GAError::CannotInsertIntoSelf);
+			return GAListBASE::ERR;
+		}
+		int i = site(where);
+		if (i < 0)
+			return GAListBASE::ERR;
+		if (!t->data.empty())
+		{
+			data.insert(data.begin() + i, t->data.begin(), t->data.end());
+			cpos = 1;
+			cur = i;
+		}
+		t->data.clear();
+		t->cur = -1;
+		return GAListBASE::NO_ERR;
+	}
+	int insert(const T &t, GAListBASE::Location where = GAListBASE::AFTER)
+	{
+		int i = site(where);
+		if (i < 0)
+			return GAListBASE::ERR;
+		data.insert(data.begin() + i, t);
+		cpos = 1;
+		cur = i;
+		return GAListBASE::NO_ERR;
+	}
+
+	T *head() { return (data.empty() ? nullptr : &data[cur = 0]); }
+	T *tail() { return (data.empty() ? nullptr : &data[cur = size() - 1]); }
+	T *current() { return (cur < 0 ? nullptr : &data[cur]); }
+	T *next()
+	{
+		return (cur < 0 ? nullptr : &data[cur = (cur + 1) % size()]);
+	}
+	T *prev()
+	{
+		return (cur < 0 ? nullptr : &data[cur = (cur + size() - 1) % size()]);
+	}
+	T *warp(unsigned int i)
+	{
+		if (i < data.size())
+			return &data[cur = i];
+		cur = (data.empty() ? -1 : 0);
+		return nullptr;
+	}
+	T *operator[](unsigned int i) { return warp(i); }
+
+  protected:
+	std::vector<T> data; // the elements in order
+	int cur = -1; // position of the iterator, -1 if it is nowhere
+	mutable std::vector<int> pos; // position of each element
+	mutable short cpos = 1; // has the order changed since the index was built?
+
+	void index() const
+	{
+		T top = (data.empty() ? 0 : *std::max_element(data.begin(), data.end()));
+		pos.assign(STA_CAST(std::size_t, top) + 1, -1);
+		for (int i = 0; i < size(); i++)
+			pos[data[i]] = i;
+		cpos = 0;
+	}
+
+	void erase(int i)
+	{
+		data.erase(data.begin() + i);
+		cpos = 1;
+	}
+
+	// Where does an insertion go?  Same rules as the list:  with no current
+	// element we can only insert at the head or tail (or anywhere, if the list
+	// is empty), and because the list is a ring, inserting before the head
+	// puts the element at the end.
+	int site(GAListBASE::Location where) const
+	{
+		if (cur < 0 && !data.empty() && where != GAListBASE::HEAD &&
+			where != GAListBASE::TAIL)
+		{
+			GAErr(GA_LOC, "GAArrayList", "insert", GAError::CannotInsertOnNilNode);
+			return -1;
+		}
+		if (data.empty())
+			return 0;
+		switch (where)
+		{
+		case GAListBASE::HEAD:
+			return 0;
+		case GAListBASE::TAIL:
+			return size();
+		case GAListBASE::BEFORE:
+			return (cur == 0 ? size() : cur);
+		case GAListBASE::AFTER:
+			return cur + 1;
+		default:
+			GAErr(GA_LOC, "GAArrayList", "insert", GAError::BadWhereIndicator);
+			return -1;
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,514 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  arraylistgenome.h
+
+ DESCRIPTION:
+  This header defines the interface for the array list genome.
+---------------------------------------------------------------------------- */
+#ifndef _ga_arraylistgenome_h_
+#define _ga_arraylistgenome_h_
+
+#include <GAArrayList.hpp>
+#include <GAEdgeRecombination.hpp>
+#include <GAGenome.h>
+#include <garandom.h>
+
+#include <cstdlib>
+#include <vector>
+
+/* ----------------------------------------------------------------------------
+ArrayListGenome
+-------------------------------------------------------------------------------
+  This is the list genome for order-based problems.  It has the members and
+the operators of GAListGenome, so code that uses a GAListGenome<int> for a
+tour can switch by changing the type.  The partial match, order and cycle
+crossovers produce the same children as the list versions (with the same
+random numbers), but they look up positions instead of searching the list, so
+they take time proportional to the length of the list rather than its square.
+There is also an edge recombination crossover.
+  The operators that change the length (the destructive mutator and the one
+point crossover) are here too, but they are not much use for permutations.
+---------------------------------------------------------------------------- */
+template <class T>
+class GAArrayListGenome : public GAArrayList<T>, public GAGenome
+{
+  public:
+	GADefineIdentity("GAArrayListGenome", GAID::ArrayListGenome);
+
+	static int DestructiveMutator(GAGenome &c, float pmut)
+	{
+		GAArrayListGenome<T> &child = DYN_CAST(GAArrayListGenome<T> &, c);
+		if (pmut <= 0.0)
+			return 0;
+
+		int n = child.size();
+		float nMut = pmut * STA_CAST(float, n);
+		if (nMut < 1.0)
+		{ // we have to do a flip test for each node
+			nMut = 0;
+			for (int i = 0; i < n; i++)
+			{
+				if (GAFlipCoin(pmut) && child.warp(i))
+				{
+					child.destroy();
+					nMut++;
+				}
+			}
+		}
+		else
+		{ // only nuke the number of nodes we need to
+			for (int i = 0; i < nMut; i++)
+			{
+				if (child.warp(GARandomInt(0, n - 1)))
+					child.destroy();
+			}
+		}
+		child.head();
+		return (STA_CAST(int, nMut));
+	}
+
+	static int SwapMutator(GAGenome &c, float pmut)
+	{
+		GAArrayListGenome<T> &child = DYN_CAST(GAArrayListGenome<T> &, c);
+		if (pmut <= 0.0)
+			return 0;
+
+		int n = child.size();
+		float nMut = pmut * STA_CAST(float, n);
+		nMut *= 0.5; // swapping one node swaps another as well
+		if (nMut < 1.0)
+		{ // we have to do a flip test for each node
+			nMut = 0;
+			for (int i = 0; i < n; i++)
+			{
+				if (GAFlipCoin(pmut))
+				{
+					child.swap(i, GARandomInt(0, n - 1));
+					nMut++;
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < nMut; i++)
+				child.swap(GARandomInt(0, n - 1), GARandomInt(0, n - 1));
+		}
+		child.head();
+		return (STA_CAST(int, nMut * 2));
+	}
+
+	// The number of positions at which the two lists differ, or the difference
+	// in length if they are not the same length.
+	static float NodeComparator(const GAGenome &a, const GAGenome &b)
+	{
+		if (&a == &b)
+			return 0;
+		const GAArrayListGenome<T> &sis = DYN_CAST(const GAArrayListGenome<T> &, a);
+		const GAArrayListGenome<T> &bro = DYN_CAST(const GAArrayListGenome<T> &, b);
+		if (sis.size() != bro.size())
+			return STA_CAST(float, std::abs(sis.size() - bro.size()));
+
+		float count = 0;
+		for (int i = 0; i < sis.size(); i++)
+			count += (sis.data[i] == bro.data[i] ? 0 : 1);
+		return count;
+	}
+
+	// The head of one parent and the tail of the other.  The sites in the two
+	// parents are picked separately, so the children can change length.
+	static int OnePointCrossover(const GAGenome &p1, const GAGenome &p2,
+								 GAGenome *c1, GAGenome *c2)
+	{
+		const GAArrayListGenome<T> &mom = DYN_CAST(const GAArrayListGenome<T> &, p1);
+		const GAArrayListGenome<T> &dad = DYN_CAST(const GAArrayListGenome<T> &, p2);
+
+		int nc = 0;
+		int a = GARandomInt(0, mom.size());
+		int b = GARandomInt(0, dad.size());
+		if (c1)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c1).splice(mom, a, dad, b);
+			nc += 1;
+		}
+		if (c2)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c2).splice(dad, b, mom, a);
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// Start with a copy of one parent, then for each position in the match
+	// section swap in the element that the other parent has there.
+	static int PartialMatchCrossover(const GAGenome &p1, const GAGenome &p2,
+									 GAGenome *c1, GAGenome *c2)
+	{
+		const GAArrayListGenome<T> &mom = DYN_CAST(const GAArrayListGenome<T> &, p1);
+		const GAArrayListGenome<T> &dad = DYN_CAST(const GAArrayListGenome<T> &, p2);
+		if (GA_CHECK(mom.size() != dad.size()))
+		{
+			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
+			return 0;
+		}
+
+		int a = GARandomInt(0, mom.size());
+		int b = GARandomInt(0, dad.size());
+		if (b < a)
+			SWAP(a, b);
+		int nc = 0;
+		if (c1)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c1).pmx(mom, dad, a, b);
+			nc += 1;
+		}
+		if (c2)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c2).pmx(dad, mom, a, b);
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// The child gets the match section of one parent.  The rest of the
+	// elements follow the match section in the order they have in the other
+	// parent, starting after the match section and wrapping around.
+	static int OrderCrossover(const GAGenome &p1, const GAGenome &p2,
+							  GAGenome *c1, GAGenome *c2)
+	{
+		const GAArrayListGenome<T> &mom = DYN_CAST(const GAArrayListGenome<T> &, p1);
+		const GAArrayListGenome<T> &dad = DYN_CAST(const GAArrayListGenome<T> &, p2);
+		if (GA_CHECK(mom.size() != dad.size()))
+		{
+			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
+			return 0;
+		}
+
+		int a = GARandomInt(0, mom.size());
+		int b = GARandomInt(0, dad.size());
+		if (b < a)
+			SWAP(a, b);
+		int nc = 0;
+		if (c1)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c1).ox(mom, dad, a, b);
+			nc += 1;
+		}
+		if (c2)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c2).ox(dad, mom, a, b);
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// Follow the cycle of positions that starts at the head.  The child gets
+	// the elements of one parent in the cycle, the other parent everywhere
+	// else.
+	static int CycleCrossover(const GAGenome &p1, const GAGenome &p2,
+							  GAGenome *c1, GAGenome *c2)
+	{
+		const GAArrayListGenome<T> &mom = DYN_CAST(const GAArrayListGenome<T> &, p1);
+		const GAArrayListGenome<T> &dad = DYN_CAST(const GAArrayListGenome<T> &, p2);
+		if (GA_CHECK(mom.size() != dad.size()))
+		{
+			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
+			return 0;
+		}
+
+		int nc = 0;
+		if (c1)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c1).cx(mom, dad);
+			nc += 1;
+		}
+		if (c2)
+		{
+			DYN_CAST(GAArrayListGenome<T> &, *c2).cx(dad, mom);
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// Edge recombination (see GAEdgeRecombination).  The parents must be
+	// tours of the same elements.
+	static int EdgeRecombinationCrossover(const GAGenome &p1, const GAGenome &p2,
+										  GAGenome *c1, GAGenome *c2)
+	{
+		const GAArrayListGenome<T> &mom = DYN_CAST(const GAArrayListGenome<T> &, p1);
+		const GAArrayListGenome<T> &dad = DYN_CAST(const GAArrayListGenome<T> &, p2);
+		if (GA_CHECK(mom.size() != dad.size()))
+		{
+			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
+			return 0;
+		}
+
+		int nc = 0;
+		if (c1)
+		{
+			if (!DYN_CAST(GAArrayListGenome<T> &, *c1).erx(mom, dad))
+			{
+				GAErr(GA_LOC, mom.className(), "cross", GAError::BadTour);
+				return nc;
+			}
+			nc += 1;
+		}
+		if (c2)
+		{
+			if (!DYN_CAST(GAArrayListGenome<T> &, *c2).erx(dad, mom))
+			{
+				GAErr(GA_LOC, mom.className(), "cross", GAError::BadTour);
+				return nc;
+			}
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// The number of edges of one tour that the other does not have (see
+	// GAEdgeDistance).  Unlike the node comparator, this does not care where
+	// the tour starts or which way it goes.
+	static float EdgeComparator(const GAGenome &a, const GAGenome &b)
+	{
+		if (&a == &b)
+			return 0;
+		const GAArrayListGenome<T> &sis = DYN_CAST(const GAArrayListGenome<T> &, a);
+		const GAArrayListGenome<T> &bro = DYN_CAST(const GAArrayListGenome<T> &, b);
+		if (sis.size() != bro.size())
+			return STA_CAST(float, std::abs(sis.size() - bro.size()));
+		return STA_CAST(float, GAEdgeDistance(sis.data.data(), bro.data.data(), sis.size()));
+	}
+
+  public:
+	GAArrayListGenome(GAGenome::Evaluator f = nullptr, void *u = nullptr)
+		: GAArrayList<T>(),
+		  GAGenome(DEFAULT_LIST_INITIALIZER, DEFAULT_LIST_MUTATOR,
+				   DEFAULT_LIST_COMPARATOR)
+	{
+		evaluator(f);
+		userData(u);
+		crossover(DEFAULT_LIST_CROSSOVER);
+	}
+
+	GAArrayListGenome(const GAArrayListGenome<T> &orig)
+		: GAArrayList<T>(), GAGenome()
+	{
+		GAArrayListGenome<T>::copy(orig);
+	}
+
+	GAArrayListGenome<T> &operator=(const GAGenome &orig)
+	{
+		copy(orig);
+		return *this;
+	}
+	~GAArrayListGenome() override = default;
+
+	GAGenome *
+	clone(GAGenome::CloneMethod flag = CloneMethod::CONTENTS) const override
+	{
+		auto *cpy = new GAArrayListGenome<T>();
+		if (flag == CloneMethod::CONTENTS)
+		{
+			cpy->copy(*this);
+		}
+		else
+		{
+			cpy->GAGenome::copy(*this);
+		}
+		return cpy;
+	}
+
+	void copy(const GAGenome &orig) override
+	{
+		if (&orig == this)
+			return;
+		const GAArrayListGenome<T> *c =
+			DYN_CAST(const GAArrayListGenome<T> *, &orig);
+		if (c)
+		{
+			GAGenome::copy(*c);
+			GAArrayList<T>::copy(*c);
+		}
+	}
+
+	// Write the elements separated by spaces.
+	int write(std::ostream &os) const override
+	{
+		for (int i = 0; i < this->size(); i++)
+			os << this->data[i] << " ";
+		return os.fail() ? 1 : 0;
+	}
+
+	bool equal(const GAGenome &c) const override
+	{
+		if (this == &c)
+			return true;
+		const GAArrayListGenome<T> &b = DYN_CAST(const GAArrayListGenome<T> &, c);
+		return this->data == b.data;
+	}
+
+	// Here we do versions of the modifiers of the array list so that we can
+	// unset the _evaluated flag.
+
+	int destroy()
+	{
+		_evaluated = false;
+		return GAArrayList<T>::destroy();
+	}
+	int swap(unsigned int i, unsigned int j)
+	{
+		_evaluated = false;
+		return GAArrayList<T>::swap(i, j);
+	}
+	T *remove()
+	{
+		_evaluated = false;
+		return GAArrayList<T>::remove();
+	}
+	int insert(GAArrayList<T> *t, GAListBASE::Location where = GAListBASE::AFTER)
+	{
+		_evaluated = false;
+		return GAArrayList<T>::insert(t, where);
+	}
+	int insert(const T &t, GAListBASE::Location where = GAListBASE::AFTER)
+	{
+		_evaluated = false;
+		return GAArrayList<T>::insert(t, where);
+	}
+
+  protected:
+	// The crossovers build the child in place.  A child that is also one of
+	// its parents works from a copy of the parents.
+	bool aliased(const GAArrayListGenome<T> &x,
+				 const GAArrayListGenome<T> &y) const
+	{
+		return (&x == this || &y == this);
+	}
+
+	// Leave the iterator at the head of the new contents.
+	void changed()
+	{
+		_evaluated = false;
+		this->cpos = 1;
+		this->cur = (this->data.empty() ? -1 : 0);
+	}
+
+	// x[0, i) followed by y[j, end)
+	void splice(const GAArrayListGenome<T> &x, int i,
+				const GAArrayListGenome<T> &y, int j)
+	{
+		if (aliased(x, y))
+		{
+			GAArrayListGenome<T> xx(x), yy(y);
+			splice(xx, i, yy, j);
+			return;
+		}
+		this->data.assign(x.data.begin(), x.data.begin() + i);
+		this->data.insert(this->data.end(), y.data.begin() + j, y.data.end());
+		changed();
+	}
+
+	// Swap each element of the match section of y into place.  Because the
+	// swaps keep the index of positions up to date, each one is a lookup.
+	void pmx(const GAArrayListGenome<T> &x, const GAArrayListGenome<T> &y,
+			 int a, int b)
+	{
+		if (aliased(x, y))
+		{
+			GAArrayListGenome<T> xx(x), yy(y);
+			pmx(xx, yy, a, b);
+			return;
+		}
+		GAArrayList<T>::copy(x);
+		for (int i = a; i < b; i++)
+		{
+			int j = this->position(y.data[i]);
+			if (j >= 0)
+				GAArrayList<T>::swap(i, j);
+		}
+		_evaluated = false;
+		this->cur = (this->data.empty() ? -1 : 0);
+	}
+
+	void ox(const GAArrayListGenome<T> &x, const GAArrayListGenome<T> &y,
+			int a, int b)
+	{
+		if (aliased(x, y))
+		{
+			GAArrayListGenome<T> xx(x), yy(y);
+			ox(xx, yy, a, b);
+			return;
+		}
+		int n = x.size();
+		static thread_local std::vector<char> taken;
+		taken.assign(std::max(x.span(), y.span()), 0);
+		this->data.resize(n);
+		for (int i = a; i < b; i++)
+		{
+			this->data[i] = y.data[i];
+			taken[y.data[i]] = 1;
+		}
+		for (int k = 0, i = (n ? b % n : 0), w = i; k < n; k++)
+		{
+			if (!taken[x.data[i]])
+			{
+				this->data[w] = x.data[i];
+				w = (w + 1 == n ? 0 : w + 1);
+			}
+			i = (i + 1 == n ? 0 : i + 1);
+		}
+		changed();
+	}
+
+	void cx(const GAArrayListGenome<T> &x, const GAArrayListGenome<T> &y)
+	{
+		if (aliased(x, y))
+		{
+			GAArrayListGenome<T> xx(x), yy(y);
+			cx(xx, yy);
+			return;
+		}
+		int n = x.size();
+		static thread_local std::vector<char> cycle;
+		cycle.assign(n, 0);
+		if (n > 0)
+		{
+			cycle[0] = 1;
+			for (int i = 0; y.data[i] != x.data[0];)
+			{
+				i = x.position(y.data[i]);
+				if (i < 0 || cycle[i])
+					break;
+				cycle[i] = 1;
+			}
+		}
+		this->data.resize(n);
+		for (int i = 0; i < n; i++)
+			this->data[i] = (cycle[i] ? x.data[i] : y.data[i]);
+		changed();
+	}
+
+	bool erx(const GAArrayListGenome<T> &x, const GAArrayListGenome<T> &y)
+	{
+		if (aliased(x, y))
+		{
+			GAArrayListGenome<T> xx(x), yy(y);
+			return erx(xx, yy);
+		}
+		std::vector<T> tour(x.size());
+		if (!GAEdgeRecombination(x.data.data(), y.data.data(), x.size(), tour.data()))
+			return false;
+		this->data.swap(tour);
+		changed();
+		return true;
+	}
+
+	// How many elements the index of positions has room for.
+	int span() const
+	{
+		if (this->cpos)
+			this->index();
+		return STA_CAST(int, this->pos.size());
+	}
+};
+
+#endif
@@ -0,0 +1,150 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GAAsyncGA.h
+
+  Header file for the asynchronous steady-state genetic algorithm class.
+
+  This is an incremental genetic algorithm whose children are evaluated on the
+threads of the executor (see GAExecutor.h).  It keeps a fixed number of
+children in flight.  Each step waits for the first of them to finish
+(whichever that is), puts it in the population, then breeds another child and
+sends it off.  There is no generation barrier, so when the evaluations take
+very different amounts of time the threads never sit idle waiting for the
+slowest one.  While it waits, the thread that calls step() evaluates children
+itself if none of the other threads has got to them yet.
+  Selection, crossover, mutation and replacement all happen on the thread
+that calls step(), so the random numbers and the population are only ever
+touched by that thread.  The other threads only call evaluate() on the
+children, so the objective function (and the delta evaluator, if any) must be
+safe to call from several threads at once.
+
+nThreads
+  The most threads that evaluate children at once.  0 (the default) means as
+  many as the executor has.
+
+nInFlight
+  How many children are being evaluated (or are waiting to be picked up) at
+  any time.  0 (the default) means one per thread.  Make this a bit bigger
+  than the number of threads if you want a thread to never wait for the GA to
+  breed its next child.
+
+replacement
+  The replacement schemes are those of the incremental GA.  For the PARENT
+  scheme, a child whose parent has left the population by the time the child
+  is done (even if the same genome has since come back as another child)
+  replaces the worst individual instead.  A child that the
+  CUSTOM replacement function decides not to insert is thrown away.
+
+nOffspring
+  With 2 offspring each mating makes two children, which are sent off one
+  after the other.
+
+wait
+  Wait for the evaluations in flight to finish and throw the children away.
+  The GA does this before it is initialized, copied or given a new objective.
+  The destructor waits for the evaluations that are already running (but not
+  for the ones that have not started).
+
+  With one thread (or with the executor inlined) the children come back in
+  the order in which they were sent, so a run is reproducible from its seed.  With more threads the order
+  depends on how long each evaluation takes.
+---------------------------------------------------------------------------- */
+#ifndef _ga_gaasync_h_
+#define _ga_gaasync_h_
+
+#include <GAExecutor.h>
+#include <GAIncGA.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class GAAsyncSteadyStateGA : public GAIncrementalGA
+{
+  public:
+	GADefineIdentity("GAAsyncSteadyStateGA", GAID::AsyncSteadyStateGA);
+
+	static GAParameterList &registerDefaultParameters(GAParameterList &);
+
+  public:
+	explicit GAAsyncSteadyStateGA(const GAGenome &);
+	explicit GAAsyncSteadyStateGA(const GAPopulation &);
+	GAAsyncSteadyStateGA(const GAAsyncSteadyStateGA &);
+	GAAsyncSteadyStateGA &operator=(const GAAsyncSteadyStateGA &);
+	~GAAsyncSteadyStateGA() override;
+	void copy(const GAGeneticAlgorithm &) override;
+
+	void initialize(unsigned int seed = 0) override;
+	void step() override;
+	GAAsyncSteadyStateGA &operator++()
+	{
+		step();
+		return *this;
+	}
+
+	int setptr(const std::string &name, const void *value) override;
+	int get(const char *name, void *value) const override;
+
+	void objectiveFunction(GAGenome::Evaluator f) override;
+	void objectiveData(const GAEvalData &v) override;
+	void recycle(const GAGenome &) override;
+
+	int nThreads() const { return nthreads; }
+	int nThreads(unsigned int);
+	int nInFlight() const { return ninflight; }
+	int nInFlight(unsigned int);
+
+	void wait();
+
+  protected:
+	// A child and the parent it replaces under the PARENT scheme, with the
+	// stamp the parent had when the child was bred.
+	struct Job
+	{
+		GAGenome *child;
+		GAGenome *parent;
+		unsigned long stamp;
+	};
+
+	unsigned int nthreads; // most threads at once (0 is the executor size)
+	unsigned int ninflight; // children in flight (0 is one per thread)
+	std::vector<GAGenome *> spare; // children that are not in use
+	std::deque<Job> bred; // children that have not been sent off yet
+	int outstanding; // children sent off and not picked up yet
+	// A genome gets a new stamp each time it goes into the population, so a
+	// child can tell its parent from a genome that has been used again since.
+	std::unordered_map<const GAGenome *, unsigned long> stamps;
+	unsigned long nstamps;
+
+	// Everything below here is shared with the threads that evaluate.
+	std::mutex lock;
+	std::condition_variable jobDone; // there is something in 'finished'
+	std::deque<Job> queued; // waiting to be evaluated
+	std::deque<Job> finished; // evaluated, waiting to be inserted
+	unsigned int draining; // chains of tasks evaluating 'queued'
+	GAExecutor::Group evaluations;
+
+	void evaluateNext();
+	void await(std::size_t nfinished);
+	void breed();
+	unsigned long stamp(const GAGenome *) const;
+	void dispatch();
+	GAGenome *spareGenome();
+	unsigned int threadCount() const;
+	unsigned int flightCount() const;
+};
+
+inline std::ostream &operator<<(std::ostream &os, GAAsyncSteadyStateGA &arg)
+{
+	arg.write(os);
+	return (os);
+}
+inline std::istream &operator>>(std::istream &is, GAAsyncSteadyStateGA &arg)
+{
+	arg.read(is);
+	return (is);
+}
+
+#endif
@@ -56,6 +56,8 @@ constexpr auto gaNnOffspring = "number_of_offspring";
 constexpr auto gaSNnOffspring = "noffspr";
 constexpr auto gaNrecordDiversity = "record_diversity";
 constexpr auto gaSNrecordDiversity = "recdiv";
+constexpr auto gaNrecordTiming = "record_timing";
+constexpr auto gaSNrecordTiming = "rectime";
 constexpr auto gaNpMigration = "migration_percentage";
 constexpr auto gaSNpMigration = "pmig";
 constexpr auto gaNnMigration = "migration_number";
@@ -64,6 +66,10 @@ constexpr auto gaNminimaxi = "minimaxi";
 constexpr auto gaSNminimaxi = "mm";
 constexpr auto gaNseed = "seed";
 constexpr auto gaSNseed = "seed";
+constexpr auto gaNnThreads = "number_of_threads";
+constexpr auto gaSNnThreads = "nthreads";
+constexpr auto gaNnInFlight = "evaluations_in_flight";
+constexpr auto gaSNnInFlight = "ninflight";
 
 extern int gaDefNumGen;
 extern float gaDefPConv;
@@ -80,8 +86,11 @@ extern int gaDefNMig;
 extern int gaDefSelectScores;
 extern int gaDefMiniMaxi;
 extern bool gaDefDivFlag;
+extern bool gaDefTimeFlag;
 extern bool gaDefElitism;
 extern int gaDefSeed;
+extern int gaDefNThreads;
+extern int gaDefNInFlight;
 
 /* ----------------------------------------------------------------------------
    The base GA class is virtual - it defines the core data elements and parts
@@ -91,7 +100,8 @@ GAlib, that is).
 initialize
   Undefined for the base class.  The initialization routine typically calls
 the population initializer (which typically calls the genome initializers).
-It should also reset the statistics.
+It should also reset the statistics and call resolveOperators so that mate and
+mutate use the built-in operators without the checks on the genome type.
 
 step
   Evolve by one generation.  'generation' can be defined different ways for
@@ -105,6 +115,13 @@ evolve
   This method is provided as a convenience so that you don't have to increment
 the GA generation-by-generation by hand.  If you do decide to do it by hand,
 be sure that you initialize before you start evolving!
+
+recycle
+  Make every genome that the GA holds a copy of the one you give it (objective
+function, user data, operators and all), so that the GA can be used again for
+another problem without making a new one.  The genomes keep the memory they
+have, so this costs little when the genome is of the same type and size as the
+ones the GA has already.  Initialize the GA before you evolve it again.
 ---------------------------------------------------------------------------- */
 class GAGeneticAlgorithm : public GAID
 {
@@ -162,6 +179,11 @@ class GAGeneticAlgorithm : public GAID
 	const GAParameterList &parameters(int &, char **, bool flag = false);
 	const GAParameterList &parameters(const std::string &filename, bool f = false);
 	const GAParameterList &parameters(std::istream &, bool flag = false);
+	// Setting a parameter through the handle sets it in the GA too.
+	template <class T> GAParameterHandle<T> parameter(const std::string &name)
+	{
+		return params.handle<T>(name);
+	}
 	virtual int get(const char *, void *) const;
 	virtual int setptr(const std::string &name, const void *);
 	int set(const std::string &s, int v) { return setptr(s, (void *)&v); }
@@ -208,6 +230,7 @@ class GAGeneticAlgorithm : public GAID
 
 	GAGenome::SexualCrossover crossover(GAGenome::SexualCrossover f)
 	{
+		xcross = f;
 		return scross = f;
 	}
 	GAGenome::SexualCrossover sexual() const { return scross; }
@@ -258,6 +281,12 @@ class GAGeneticAlgorithm : public GAID
 		params.set(gaNrecordDiversity, static_cast<int>(f));
 		return stats.recordDiversity(f);
 	}
+	bool recordTiming() const { return stats.recordTiming(); }
+	bool recordTiming(bool f)
+	{
+		params.set(gaNrecordTiming, static_cast<int>(f));
+		return stats.recordTiming(f);
+	}
 
 	virtual const GAPopulation &population() const { return *pop; }
 	virtual const GAPopulation &population(const GAPopulation &);
@@ -282,8 +311,27 @@ class GAGeneticAlgorithm : public GAID
 	}
 	virtual void objectiveFunction(GAGenome::Evaluator f);
 	virtual void objectiveData(const GAEvalData &v);
+	virtual void recycle(const GAGenome &);
 
   protected:
+	void resolveOperators(const GAPopulation &);
+	void resetOperators();
+	void listenToParameters();
+
+	// Mate and mutate with the operators found by resolveOperators.  The
+	// mutator is per genome, so we make sure that the genome still has the
+	// one we resolved.
+	int mate(const GAGenome &mom, const GAGenome &dad, GAGenome *c1,
+			 GAGenome *c2)
+	{
+		return (*xcross)(mom, dad, c1, c2);
+	}
+	int mutate(GAGenome &g)
+	{
+		return (xmut != nullptr && g.mutator() == xmutsrc) ? (*xmut)(g, pmut)
+															: g.mutate(pmut);
+	}
+
 	GAStatistics stats;
 	GAParameterList params;
 	GAPopulation *pop;
@@ -299,6 +347,9 @@ class GAGeneticAlgorithm : public GAID
 	int minmax;
 	GAGenome::SexualCrossover scross; // sexual crossover to use
 	GAGenome::AsexualCrossover across; // asexual crossover to use
+	GAGenome::SexualCrossover xcross; // scross without the type checks
+	GAGenome::Mutator xmutsrc; // the genome mutator that was resolved
+	GAGenome::Mutator xmut; // and its version without the type checks
 };
 
 #endif
@@ -0,0 +1,146 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GABatch.h
+
+ DESCRIPTION:
+  Do a batch of small, independent runs of genetic algorithms on a pool of
+threads.  A run is a genome (which carries the objective function and its user
+data), a list of parameters for the GA and the kind of GA to use.  The batch
+hands the runs out to the threads and gives back the best genome and the
+statistics of each one.
+  Making a GA means making its populations, and for small problems that can
+cost as much as the evolution itself.  So each thread keeps the last few GAs
+it used, and a run whose GA, setup and genome type match one of those uses it
+again:  the genomes of the GA are made copies of the genome of the run (see
+recycle in GABaseGA.h) and the parameters of the GA are put back to what they
+were when it was made before the ones of the run are set.
+  Each run gets a random number generator of its own, seeded with the seed of
+the run (or, if that is 0, with a seed made from the seed of the batch and the
+number of the run).  The result of a run depends only on its seed, not on which
+thread does it, how many threads there are or whether it got a new GA or a
+used one.
+
+add
+  Add a run to the batch and return its number.  The batch keeps a pointer to
+  the genome, so the genome must last until the batch has done the run.  If
+  there is no maker the run uses a simple GA.  The setup, if any, is called
+  with the GA after the parameters have been set, for the things that are not
+  parameters (the scaling, the selector or the terminator, for example).  It
+  must do the same thing every time, since a used GA keeps what it did.
+
+evolve
+  Do all of the runs that have not been done yet and return when they are
+  done.  Do not add runs while the batch is evolving.
+
+result
+  The best genome, the statistics and the seed of a run that has been done.
+
+clear
+  Forget the runs and their results.  The threads keep their GAs for the next
+  batch.
+
+nThreads
+  The number of threads to use (0, the default, means one per hardware thread).
+
+seed
+  The seed that the runs without a seed of their own get theirs from.  If it
+  is 0 when the batch evolves, we pick one with the random number generator of
+  the calling thread.
+
+nReused
+  The number of runs so far that used a GA that had been used before.
+---------------------------------------------------------------------------- */
+#ifndef _ga_batch_h_
+#define _ga_batch_h_
+
+#include <GABaseGA.h>
+#include <GAThreadPool.h>
+
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+class GABatch
+{
+  public:
+	using Maker = GAGeneticAlgorithm *(*)(const GAGenome &);
+	using Setup = void (*)(GAGeneticAlgorithm &);
+
+	// A maker for any of the GAs, e.g. GABatch::Make<GASteadyStateGA>
+	template <class GA> static GAGeneticAlgorithm *Make(const GAGenome &g)
+	{
+		return new GA(g);
+	}
+
+	struct Run
+	{
+		const GAGenome *genome = nullptr;
+		GAParameterList parameters;
+		Maker maker = nullptr; // a simple GA if nullptr
+		Setup setup = nullptr;
+		void *userData = nullptr; // for the GA
+		unsigned int seed = 0; // 0 means make one from the seed of the batch
+	};
+
+	struct Result
+	{
+		std::unique_ptr<GAGenome> best;
+		GAStatistics statistics;
+		unsigned int seed = 0;
+		bool done = false;
+		bool reused = false; // whether the run had a used GA
+	};
+
+  public:
+	explicit GABatch(unsigned int nthreads = 0);
+	GABatch(const GABatch &) = delete;
+	GABatch &operator=(const GABatch &) = delete;
+	~GABatch();
+
+	int add(const Run &);
+	int add(const GAGenome &, const GAParameterList & = GAParameterList(),
+			Maker = nullptr);
+	int size() const { return static_cast<int>(runs.size()); }
+	const Run &run(int i) const { return runs[i]; }
+	const Result &result(int i) const { return results[i]; }
+	void clear();
+
+	void evolve();
+
+	unsigned int nThreads() const { return pool.size(); }
+	unsigned int nThreads(unsigned int n)
+	{
+		pool.size(n);
+		return pool.size();
+	}
+	unsigned int seed() const { return bseed; }
+	unsigned int seed(unsigned int s) { return bseed = s; }
+	int nReused() const { return nreused; }
+
+  protected:
+	// A GA that a thread has used, the kind of run it was for and the
+	// parameters it had when it was made.
+	struct Spare
+	{
+		Maker maker;
+		Setup setup;
+		const std::type_info *type;
+		GAGeneticAlgorithm *ga;
+		GAParameterList defaults;
+		int used; // the last run it did (for throwing it away)
+	};
+
+	std::vector<Run> runs;
+	std::vector<Result> results;
+	int ndone; // the runs before this one have been done
+	int ncleared; // runs in the batches that were cleared (for Spare::used)
+	unsigned int bseed;
+	int nreused;
+	GAThreadPool pool;
+	std::vector<std::vector<Spare>> spares; // the GAs of each thread
+
+	GAGeneticAlgorithm &spare(int worker, int i, bool &reused);
+	void evolve(int i, int worker);
+};
+
+#endif
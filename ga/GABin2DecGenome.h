@@ -30,6 +30,7 @@ out, please turn off the lights).
 #define _ga_bin2dec_h_
 
 #include <GA1DBinStrGenome.h>
+#include <atomic>
 #include <gabincvt.h>
 
 #ifdef max
@@ -48,7 +49,7 @@ class GABin2DecPhenotypeCore
 	virtual ~GABin2DecPhenotypeCore();
 	GABin2DecPhenotypeCore &operator=(const GABin2DecPhenotypeCore &);
 
-	unsigned int cnt; // how many references to us?
+	std::atomic<unsigned int> cnt; // how many references to us?
 	unsigned int csz; // how big are the chunks we allocate?
 	unsigned int n{0}, N{0}; // how many phenotypes do we have? (real,alloc)
 	uint16_t *nbits; // number of bits that max/min get mapped into
@@ -67,8 +68,7 @@ class GABin2DecPhenotype
 	}
 	virtual ~GABin2DecPhenotype()
 	{
-		core->cnt -= 1;
-		if (core->cnt == 0)
+		if (--core->cnt == 0)
 		{
 			delete core;
 		}
@@ -84,8 +84,7 @@ class GABin2DecPhenotype
 	GABin2DecPhenotype *clone() const { return new GABin2DecPhenotype(*this); }
 	void link(GABin2DecPhenotype &p)
 	{
-		core->cnt -= 1;
-		if (core->cnt == 0)
+		if (--core->cnt == 0)
 		{
 			delete core;
 		}
@@ -119,12 +118,19 @@ inline bool operator!=(const GABin2DecPhenotype &a, const GABin2DecPhenotype &b)
 /* ----------------------------------------------------------------------------
    The phenotype does reference counting, so we can make a copy of it for our
 own use and we don't have to worry about extra overhead.
+   PhenotypeEmbedding writes the phenotypes of the genome as the coordinates
+of a point (nPhenotypes of them), for the niching schemes.  The distance
+between those points is not what the default comparator (BitComparator)
+returns, so the schemes only use it if you give it to them; they use the bits
+(BitEmbedding) otherwise.
 ---------------------------------------------------------------------------- */
 class GABin2DecGenome : public GA1DBinaryStringGenome
 {
   public:
 	GADefineIdentity("GABin2DecGenome", GAID::Bin2DecGenome);
 
+	static void PhenotypeEmbedding(const GAGenome &, float *);
+
   public:
 	explicit GABin2DecGenome(const GABin2DecPhenotype &p,
 					GAGenome::Evaluator f = nullptr, void *u = nullptr)
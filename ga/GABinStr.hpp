@@ -82,10 +82,15 @@ class GABinaryString
 	 * @param lhsIdx index of left hand side
 	 * @param rhsIdx  index of right hand side
 	 * @param l length
-	 * @return true, if equal 
+	 * @return true, if equal (false if either range runs off the end)
 	 */
 	bool equal(const GABinaryString &rhs, unsigned int lhsIdx, unsigned int rhsIdx, unsigned int l) const
 	{
+		if (static_cast<std::size_t>(lhsIdx) + l > data.size() ||
+			static_cast<std::size_t>(rhsIdx) + l > rhs.data.size())
+		{
+			return false;
+		}
 		return (std::memcmp(&data[lhsIdx], &rhs.data[rhsIdx], l) != 0 ? false : true);
 	}
 
@@ -4,20 +4,44 @@
   mbwall 29mar99
   Copyright (c) 1999 Matthew Wall, all rights reserved
 
-  Header file for the steady-state genetic algorithm class.
+  Header file for the deterministic crowding genetic algorithm class.
+
+  Each generation the population is shuffled and paired off.  Each pair makes
+a child, and the child replaces whichever parent it is closer to if it is
+better than that parent.  The pairs have nothing to do with one another, so
+they are done in parallel on nThreads threads (0, the default, means one per
+hardware thread).
+  The pairs are done in fixed batches, and each batch starts its own random
+number stream from a seed that the GA draws before the batches start, so a run
+gets the same answer from the same seed whatever the number of threads.  (It
+does not get the answer it got before the pairs were done in parallel.)  The
+objective, the crossover, the mutator and the comparator must be safe to call
+from several threads at once.  The seed that GAGetRandomSeed reports is still
+the one the GA was started with.
+  If timing is on, each batch times its crossovers, mutations, evaluations and
+replacements, and the time the batches took is shared out among those phases
+in proportion, so the phases add up to the time the generation took.
 ---------------------------------------------------------------------------- */
 #ifndef _ga_deterministic_crowding_ga_h_
 #define _ga_deterministic_crowding_ga_h_
 
 #include <GABaseGA.h>
+#include <GAThreadPool.h>
+
+#include <vector>
 
 class GADCrowdingGA : public GAGeneticAlgorithm
 {
   public:
 	GADefineIdentity("GADeterministicCrowdingGA", 241);
 
-	explicit GADCrowdingGA(const GAGenome &g) : GAGeneticAlgorithm(g) {}
-	~GADCrowdingGA() override = default;
+	static GAParameterList &registerDefaultParameters(GAParameterList &);
+
+	explicit GADCrowdingGA(const GAGenome &g);
+	GADCrowdingGA(const GADCrowdingGA &);
+	GADCrowdingGA &operator=(const GADCrowdingGA &);
+	~GADCrowdingGA() override;
+	void copy(const GAGeneticAlgorithm &) override;
 
 	void initialize(unsigned int seed = 0) override;
 	void step() override;
@@ -26,6 +50,33 @@ class GADCrowdingGA : public GAGeneticAlgorithm
 		step();
 		return *this;
 	}
+
+	int setptr(const std::string &name, const void *value) override;
+	int get(const char *name, void *value) const override;
+
+	int nThreads() const { return nthreads; }
+	int nThreads(unsigned int);
+
+  protected:
+	// The number of pairs in each batch.
+	static constexpr int PAIRS_PER_BATCH = 8;
+
+	// What each batch adds to the statistics (the times only if timing is on).
+	struct Counts
+	{
+		int numsel{0}, numcro{0}, nummut{0}, numeval{0}, numrep{0};
+		double tcro{0.0}, tmut{0.0}, teval{0.0}, trep{0.0};
+	};
+
+	unsigned int nthreads; // number of threads (0 is one per core)
+	GAThreadPool pool;
+	std::vector<GAGenome *> children; // one child for each worker
+	std::vector<int> order; // the shuffled population
+	std::vector<unsigned int> seeds; // one random seed for each batch
+	std::vector<Counts> counts; // one set of counts for each batch
+
+	void crowd(int batch, int worker);
+	void deleteChildren();
 };
 
 #endif
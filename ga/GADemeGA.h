@@ -89,6 +89,7 @@ class GADemeGA : public GAGeneticAlgorithm
 		GAGeneticAlgorithm::objectiveData(v);
 		objectiveData(ALL, v);
 	}
+	void recycle(const GAGenome &) override;
 
 	const GAPopulation &population(unsigned int i) const { return *deme[i]; }
 	const GAPopulation &population(int i, const GAPopulation &);
@@ -0,0 +1,178 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  edgerecomb.h
+
+ DESCRIPTION:
+  This defines edge recombination and the edge distance for tours, the
+order-based genomes whose elements are the towns of a round trip.
+---------------------------------------------------------------------------- */
+#ifndef _ga_edgerecomb_h_
+#define _ga_edgerecomb_h_
+
+#include <gaconfig.h>
+#include <garandom.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/* ----------------------------------------------------------------------------
+ Edge recombination
+-------------------------------------------------------------------------------
+  A tour is an array of n distinct integers that are not negative (the towns).
+It is a round trip, so the last town is next to the first one.  The edges of a
+tour are the pairs of towns that are next to each other, in either direction.
+
+GAEdgeRecombination
+  Make a child tour out of the edges of two parent tours (Whitley's edge
+  recombination).  Start at a random town.  From each town go on to one of its
+  neighbours (in either parent) that is not in the child yet:  a neighbour in
+  both parents if there is one, otherwise the one with the fewest neighbours
+  left, with ties broken at random.  If there is no such neighbour, go to a
+  random town that is not in the child yet.
+    The neighbours are kept in a flat table with four slots for each town and
+  a bit for each slot that says whether both parents have that edge.  The
+  towns that are already in the child are kept in a bit mask.  The tables are
+  kept from one call to the next (one set per thread), so once they are big
+  enough a call does not allocate.  Their size is the largest town plus one.
+    Returns false, and leaves the child alone, if the parents are not tours of
+  the same towns.
+
+GAEdgeDistance
+  Return the number of edges of the first tour that the second tour does not
+  have.  This is 0 for the same tour (whatever the first town and the
+  direction) and n for two tours with no edge in common.  A town that is not
+  in the second tour counts both of its edges as different.
+---------------------------------------------------------------------------- */
+template <class T> bool GAEdgeRecombination(const T *x, const T *y, int n, T *child)
+{
+	static_assert(std::is_integral<T>::value, "the towns of a tour must be integers");
+	static thread_local std::vector<int> edges, pool, where;
+	static thread_local std::vector<unsigned char> degree, common;
+	static thread_local std::vector<std::uint64_t> used;
+
+	if (n <= 0)
+		return (n == 0);
+	T lo = std::min(*std::min_element(x, x + n), *std::min_element(y, y + n));
+	T hi = std::max(*std::max_element(x, x + n), *std::max_element(y, y + n));
+	if (lo < 0)
+		return false;
+	int m = STA_CAST(int, hi) + 1;
+
+	// Mark the mother's towns, then unmark the father's.  If the father has
+	// a town that is not marked, it is either not in the mother or in the
+	// father twice.
+	used.assign((m + 63) / 64, 0);
+	auto bit = [](int t) { return STA_CAST(std::uint64_t, 1) << (t & 63); };
+	for (int i = 0; i < n; i++)
+	{
+		if (used[x[i] >> 6] & bit(x[i]))
+			return false;
+		used[x[i] >> 6] |= bit(x[i]);
+	}
+	for (int i = 0; i < n; i++)
+	{
+		if (!(used[y[i] >> 6] & bit(y[i])))
+			return false;
+		used[y[i] >> 6] &= ~bit(y[i]);
+	}
+
+	edges.resize(4 * STA_CAST(std::size_t, m));
+	degree.assign(m, 0);
+	common.assign(m, 0);
+	for (const T *p : {x, y})
+	{
+		for (int i = 0; i < n; i++)
+		{
+			int v = p[i];
+			int u[2] = {STA_CAST(int, p[i == 0 ? n - 1 : i - 1]),
+						STA_CAST(int, p[i + 1 == n ? 0 : i + 1])};
+			for (int w : u)
+			{
+				int k = 0;
+				while (k < degree[v] && edges[4 * v + k] != w)
+					k++;
+				if (k == degree[v])
+					edges[4 * v + degree[v]++] = w;
+				else if (p == y)
+					common[v] |= (1 << k);
+			}
+		}
+	}
+
+	// The towns that are not in the child yet, so that we can pick one at
+	// random in constant time.
+	pool.assign(x, x + n);
+	where.resize(m);
+	for (int i = 0; i < n; i++)
+		where[pool[i]] = i;
+
+	int v = pool[GARandomInt(0, n - 1)];
+	for (int c = 0;;)
+	{
+		child[c++] = STA_CAST(T, v);
+		used[v >> 6] |= bit(v);
+		int last = pool.back();
+		pool[where[v]] = last;
+		where[last] = where[v];
+		pool.pop_back();
+		if (c == n)
+			break;
+
+		int next = -1, best = 5, ties = 0;
+		for (int k = 0; k < degree[v]; k++)
+		{
+			int u = edges[4 * v + k];
+			if (used[u >> 6] & bit(u))
+				continue;
+			int score = -1;
+			if (!(common[v] & (1 << k)))
+			{
+				score = 0;
+				for (int j = 0; j < degree[u]; j++)
+					score += !(used[edges[4 * u + j] >> 6] & bit(edges[4 * u + j]));
+			}
+			if (score < best)
+			{
+				best = score;
+				next = u;
+				ties = 1;
+			}
+			else if (score == best && GARandomInt(0, ties++) == 0)
+			{
+				next = u;
+			}
+		}
+		if (next < 0)
+			next = pool[GARandomInt(0, STA_CAST(int, pool.size()) - 1)];
+		v = next;
+	}
+	return true;
+}
+
+template <class T> int GAEdgeDistance(const T *x, const T *y, int n)
+{
+	static_assert(std::is_integral<T>::value, "the towns of a tour must be integers");
+	static thread_local std::vector<int> pos;
+
+	if (n <= 0)
+		return 0;
+	T hi = *std::max_element(y, y + n);
+	pos.assign(hi < 0 ? 0 : STA_CAST(std::size_t, hi) + 1, -1);
+	for (int i = 0; i < n; i++)
+		if (y[i] >= 0)
+			pos[y[i]] = i;
+
+	int d = 0;
+	for (int i = 0; i < n; i++)
+	{
+		T a = x[i], b = x[i + 1 == n ? 0 : i + 1];
+		int k = (a >= 0 && a <= hi ? pos[a] : -1);
+		if (k < 0 || (y[k + 1 == n ? 0 : k + 1] != b && y[k == 0 ? n - 1 : k - 1] != b))
+			d++;
+	}
+	return d;
+}
+
+#endif
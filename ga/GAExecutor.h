@@ -0,0 +1,162 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GAExecutor.h
+
+ DESCRIPTION:
+  The one set of worker threads that all of the parallel parts of the library
+share.  If each of them had threads of its own, using one inside another (the
+deme GA with a parallel scaling in each deme, a GA inside the objective of
+another, a batch of GAs that each run in parallel) would start far more
+threads than there are cores.  Instead they all hand their work to the
+executor, as tasks in groups.
+  Each worker has a queue of its own.  A task that is submitted by a worker
+goes to the back of its queue, and the worker takes the newest task from the
+back of its queue first.  A task submitted by any other thread goes to a
+queue that all of the workers share.  A worker that has nothing to do takes
+the oldest task from the shared queue or steals the oldest one from the queue
+of another worker.
+  The thread that waits for a group works on the tasks of that group that
+nobody has started yet (and only on those, so that a task of some other group
+cannot change the random number generator of the waiting thread under its
+feet).  Nested parallelism cannot deadlock:  a thread that waits either has a
+task of its own to do, or all of its tasks are running on other threads and
+they will finish.
+
+instance
+  The executor.  It starts its workers the first time it is given a task.
+
+size
+  The number of threads that work on the tasks, counting the one that waits.
+  0 (the default) means one per hardware thread.  Changing it stops the
+  workers, and the next task starts as many as it needs.  So it can only be
+  changed when no group has a task that is not done, and not by a task: a
+  change from a task, or while there are tasks, is refused with an error
+  (ExecutorBusy) and nothing changes.  Do not change it while another thread
+  may be submitting tasks.
+
+pinned
+  Whether each worker stays on a core of its own (Linux only).  This stops
+  the workers too, so it is refused in the same way as size.
+
+inlined
+  When this is on, a task is done right away, on the thread that submits it,
+  so everything happens in the same order on one thread and a run is
+  reproducible whatever the size.
+
+submit
+  Add a task to the group.  The group must last until its tasks are done.
+
+help
+  Do one task of the group that nobody has started yet.  Returns false if
+  there are none.
+
+wait
+  Help with the tasks of the group until they are all done.
+
+cancel
+  Drop the tasks of the group that nobody has started, then wait for the ones
+  that are running.
+---------------------------------------------------------------------------- */
+#ifndef _ga_executor_h_
+#define _ga_executor_h_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class GAExecutor
+{
+  public:
+	using Task = std::function<void()>;
+
+  protected:
+	struct Item;
+	using ItemPtr = std::shared_ptr<Item>;
+
+  public:
+	class Group
+	{
+	  public:
+		Group() : pending(0) {}
+		Group(const Group &) = delete;
+		Group &operator=(const Group &) = delete;
+		~Group() { GAExecutor::instance().cancel(*this); }
+
+		int size() const { return pending; } // tasks not done yet
+
+	  protected:
+		friend class GAExecutor;
+		std::atomic<int> pending;
+		std::mutex lock;
+		std::condition_variable done; // the last task is done
+		std::vector<ItemPtr> items; // tasks that may not have started yet
+	};
+
+	static GAExecutor &instance();
+
+	GAExecutor(const GAExecutor &) = delete;
+	GAExecutor &operator=(const GAExecutor &) = delete;
+	~GAExecutor();
+
+	unsigned int size() const;
+	void size(unsigned int nthreads);
+	bool pinned() const { return pin; }
+	void pinned(bool flag);
+	bool inlined() const { return inl; }
+	void inlined(bool flag) { inl = flag; }
+
+	void submit(Group &, Task);
+	bool help(Group &);
+	void wait(Group &);
+	void cancel(Group &);
+
+  protected:
+	// A task, the group it belongs to, and whether some thread has taken it.
+	// The queues and the group both point to it, so whichever gets to it
+	// first runs it and the other finds it claimed.
+	struct Item
+	{
+		Task task;
+		Group *group;
+		std::atomic<bool> claimed;
+	};
+
+	struct Queue
+	{
+		std::mutex lock;
+		std::deque<ItemPtr> items;
+	};
+
+	GAExecutor();
+
+	unsigned int nthreads; // 0 is one per hardware thread
+	bool pin;
+	std::atomic<bool> inl;
+
+	std::mutex startLock; // for starting and stopping the workers
+	std::atomic<bool> running; // the workers have been started
+	std::atomic<int> nworkers;
+	std::vector<std::thread> workers;
+	std::vector<std::unique_ptr<Queue>> queues; // one for each worker
+	Queue shared; // tasks from threads that are not workers
+	std::atomic<int> nqueued; // items in all of the queues
+	std::atomic<int> npending; // tasks in all of the groups not done yet
+	std::mutex sleepLock;
+	std::condition_variable wake; // something was queued (or quit)
+	bool quit;
+
+	void start();
+	void stop();
+	bool busy(const char *func) const;
+	void work(int worker);
+	ItemPtr take(int worker);
+	void run(Item &);
+	static void finish(Group &);
+};
+
+#endif
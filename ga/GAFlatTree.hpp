@@ -0,0 +1,398 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  flattree.h
+
+ DESCRIPTION:
+  This defines the flat tree:  a tree whose nodes are stored in arrays rather
+  than linked together with pointers.
+---------------------------------------------------------------------------- */
+#ifndef _ga_flattree_h_
+#define _ga_flattree_h_
+
+#include <GATree.hpp>
+#include <gaerror.h>
+
+#include <algorithm>
+#include <vector>
+
+/* ----------------------------------------------------------------------------
+ GAFlatTree
+-------------------------------------------------------------------------------
+  The nodes of a flat tree are kept in depth-first (prefix) order, so the root
+is node 0, its first child is node 1, and the subtree of any node is the run of
+nodes that follows it.  For each node we keep its contents, its extent (the
+number of nodes in its subtree, counting the node itself) and its level (the
+root is on level 0).  The three are kept in separate arrays so that a walk over
+the contents does not drag the bookkeeping through the cache.
+  Because every subtree is a contiguous block, the operations that the tree
+genome does most - copying a tree, cutting out a subtree, putting a subtree
+from another tree in its place, and swapping two subtrees - are block moves
+instead of pointer surgery.  Finding the parent of a node means scanning
+backwards to the closest node on a higher level, so that is the slow one.
+  The node indices are the same as those of a GATree with the same shape.
+Unlike the GATree, there is no iterator:  you address the nodes by index.
+
+creation
+  Create an empty tree, a tree with only a root node, or a copy of a GATree.
+
+insert
+  Add a node as the youngest child of the specified node.  If you don't
+  specify a parent, the node becomes the new root and the old root (if any)
+  becomes its only child.  Returns the index of the new node, or -1 if the
+  parent does not exist.
+
+destroy
+  Remove a node and its subtree.  Destroying the root empties the tree.
+
+swap
+  Exchange the contents of two nodes.  The shape of the tree does not change.
+
+swaptree
+  Exchange two subtrees of this tree.  Neither node may be an ancestor of the
+  other.
+
+replace
+  Replace the subtree at a node with a copy of a subtree of another (or the
+  same) tree.  This is what the crossover does.
+
+clone
+  Return a new tree that is a copy of the subtree at the specified node, or
+  NULL if there is no such node.
+
+extent, level, skip, parent, nchildren
+  The shape of the tree.  skip(i) is the index of the first node after the
+  subtree of node i, so the children of node i are i+1, skip(i+1), and so on
+  up to i+extent(i).  For example, an objective that interprets the tree as
+  an expression can walk it like this:
+
+	float eval(const GAFlatTree<Op> &t, unsigned int i)
+	{
+		float v = 0;
+		for (unsigned int c = i + 1; c < t.skip(i); c = t.skip(c))
+			v = t[i].apply(v, eval(t, c));
+		return v;
+	}
+
+ancestral
+  Is node i an ancestor of node j or vice versa?  A node is its own ancestor.
+---------------------------------------------------------------------------- */
+template <class T> class GAFlatTree
+{
+  public:
+	enum
+	{
+		NO_ERR = 0,
+		ERR = -1
+	};
+
+	GAFlatTree() = default;
+	explicit GAFlatTree(const T &t) : data(1, t), ext(1, 1), lvl(1, 0) {}
+	explicit GAFlatTree(const GATree<T> &t) { copy(t); }
+	GAFlatTree(const GAFlatTree<T> &orig) = default;
+	GAFlatTree<T> &operator=(const GAFlatTree<T> &orig) = default;
+	virtual ~GAFlatTree() = default;
+
+	void copy(const GAFlatTree<T> &orig)
+	{
+		data = orig.data;
+		ext = orig.ext;
+		lvl = orig.lvl;
+	}
+
+	// Take the nodes of a linked tree in depth-first order.  The level of each
+	// node comes from its parent pointers, the extents from the levels.
+	void copy(const GATree<T> &orig)
+	{
+		int n = orig.size();
+		data.clear();
+		lvl.clear();
+		data.reserve(n);
+		lvl.reserve(n);
+		for (int i = 0; i < n; i++)
+		{
+			GANodeBASE *node = orig.node(i);
+			int l = 0;
+			for (GANodeBASE *p = node->parent; p != nullptr; p = p->parent)
+				l++;
+			data.push_back(STA_CAST(GANode<T> *, node)->contents);
+			lvl.push_back(l);
+		}
+		extents();
+	}
+
+	GAFlatTree<T> *clone(unsigned int i = 0) const
+	{
+		if (i >= data.size())
+			return nullptr;
+		auto *t = new GAFlatTree<T>;
+		t->data.assign(data.begin() + i, data.begin() + i + ext[i]);
+		t->ext.assign(ext.begin() + i, ext.begin() + i + ext[i]);
+		t->lvl.assign(lvl.begin() + i, lvl.begin() + i + ext[i]);
+		for (int &l : t->lvl)
+			l -= lvl[i];
+		return t;
+	}
+
+	int size() const { return STA_CAST(int, data.size()); }
+	int depth() const
+	{
+		return (lvl.empty() ? 0 : 1 + *std::max_element(lvl.begin(), lvl.end()));
+	}
+
+	T &operator[](unsigned int i) { return data[i]; }
+	const T &operator[](unsigned int i) const { return data[i]; }
+	unsigned int extent(unsigned int i) const { return ext[i]; }
+	unsigned int level(unsigned int i) const { return lvl[i]; }
+	unsigned int skip(unsigned int i) const { return i + ext[i]; }
+	int parent(unsigned int i) const
+	{
+		if (i >= data.size())
+			return -1;
+		int k = i - 1;
+		while (k >= 0 && lvl[k] >= lvl[i])
+			k--;
+		return k;
+	}
+	int nchildren(unsigned int i) const
+	{
+		int n = 0;
+		for (unsigned int c = i + 1; c < skip(i); c = skip(c))
+			n++;
+		return n;
+	}
+	int ancestral(unsigned int i, unsigned int j) const
+	{
+		if (i >= data.size() || j >= data.size())
+			return 1;
+		return ((i <= j && j < skip(i)) || (j <= i && i < skip(j))) ? 1 : 0;
+	}
+
+	int insert(const T &t)
+	{
+		data.insert(data.begin(), t);
+		ext.insert(ext.begin(), STA_CAST(int, data.size()));
+		for (int &l : lvl)
+			l++;
+		lvl.insert(lvl.begin(), 0);
+		return 0;
+	}
+	int insert(const T &t, unsigned int p)
+	{
+		if (p >= data.size())
+		{
+			GAErr(GA_LOC, "GAFlatTree", "insert", GAError::CannotInsertOnNilNode);
+			return -1;
+		}
+		unsigned int i = skip(p);
+		ext[p]++;
+		resize(p, 1);
+		data.insert(data.begin() + i, t);
+		ext.insert(ext.begin() + i, 1);
+		lvl.insert(lvl.begin() + i, lvl[p] + 1);
+		return i;
+	}
+
+	int destroy(unsigned int i)
+	{
+		if (i >= data.size())
+			return ERR;
+		unsigned int n = ext[i];
+		resize(i, -STA_CAST(int, n));
+		data.erase(data.begin() + i, data.begin() + i + n);
+		ext.erase(ext.begin() + i, ext.begin() + i + n);
+		lvl.erase(lvl.begin() + i, lvl.begin() + i + n);
+		return NO_ERR;
+	}
+
+	int swap(unsigned int i, unsigned int j)
+	{
+		if (i >= data.size() || j >= data.size())
+			return ERR;
+		std::swap(data[i], data[j]);
+		return NO_ERR;
+	}
+
+	// The two subtrees and the nodes between them are one block.  We fix the
+	// extents of the nodes that contain one subtree but not the other, shift
+	// the levels of the two subtrees, then rotate the block so that the
+	// subtrees trade places.
+	int swaptree(unsigned int i, unsigned int j)
+	{
+		if (i >= data.size() || j >= data.size())
+			return ERR;
+		if (i == j)
+			return NO_ERR;
+		if (ancestral(i, j))
+		{
+			GAErr(GA_LOC, "GAFlatTree", "swaptree", GAError::CannotSwapAncestors);
+			return ERR;
+		}
+		unsigned int a = std::min(i, j), b = std::max(i, j);
+		int na = ext[a], nb = ext[b], la = lvl[a], lb = lvl[b];
+
+		for (int k = a - 1, l = la; k >= 0 && l > 0; k--)
+		{
+			if (lvl[k] < l)
+			{
+				if (STA_CAST(unsigned int, k + ext[k]) > b)
+					break;
+				ext[k] += nb - na;
+				l = lvl[k];
+			}
+		}
+		for (int k = b - 1, l = lb; k > STA_CAST(int, a) && l > 0; k--)
+		{
+			if (lvl[k] < l)
+			{
+				ext[k] += na - nb;
+				l = lvl[k];
+			}
+		}
+		for (unsigned int k = a; k < a + na; k++)
+			lvl[k] += lb - la;
+		for (unsigned int k = b; k < b + nb; k++)
+			lvl[k] += la - lb;
+
+		rotate(data, a, na, b, nb);
+		rotate(ext, a, na, b, nb);
+		rotate(lvl, a, na, b, nb);
+		return NO_ERR;
+	}
+
+	int replace(unsigned int i, const GAFlatTree<T> &t, unsigned int j)
+	{
+		if (i >= data.size() || j >= t.data.size())
+			return ERR;
+		if (&t == this)
+		{
+			GAFlatTree<T> *sub = clone(j);
+			int status = replace(i, *sub, 0);
+			delete sub;
+			return status;
+		}
+		int n = ext[i], m = t.ext[j], d = lvl[i] - t.lvl[j];
+		resize(i, m - n);
+		splice(data, i, n, t.data, j, m);
+		splice(ext, i, n, t.ext, j, m);
+		splice(lvl, i, n, t.lvl, j, m);
+		for (unsigned int k = i; k < i + m; k++)
+			lvl[k] += d;
+		return NO_ERR;
+	}
+
+  protected:
+	std::vector<T> data; // contents of the nodes in depth-first order
+	std::vector<int> ext; // number of nodes in the subtree of each node
+	std::vector<int> lvl; // level of each node (the root is 0)
+
+	// Make this a copy of x with the subtree at i replaced by the subtree of y
+	// at j.  We copy the parts around the crossover site instead of copying
+	// all of x and then replacing the subtree.
+	void cross(const GAFlatTree<T> &x, unsigned int i, const GAFlatTree<T> &y,
+			   unsigned int j)
+	{
+		if (&x == this || &y == this)
+		{
+			GAFlatTree<T> tmp;
+			tmp.cross(x, i, y, j);
+			copy(tmp);
+			return;
+		}
+		unsigned int n = x.extent(i), m = y.extent(j);
+		int d = x.level(i) - y.level(j);
+		data.clear();
+		data.insert(data.end(), x.data.begin(), x.data.begin() + i);
+		data.insert(data.end(), y.data.begin() + j,
+						  y.data.begin() + j + m);
+		data.insert(data.end(), x.data.begin() + i + n, x.data.end());
+		ext.assign(x.ext.begin(), x.ext.begin() + i);
+		ext.insert(ext.end(), y.ext.begin() + j, y.ext.begin() + j + m);
+		ext.insert(ext.end(), x.ext.begin() + i + n, x.ext.end());
+		lvl.assign(x.lvl.begin(), x.lvl.begin() + i);
+		for (unsigned int k = j; k < j + m; k++)
+			lvl.push_back(y.lvl[k] + d);
+		lvl.insert(lvl.end(), x.lvl.begin() + i + n, x.lvl.end());
+		resize(i, STA_CAST(int, m) - STA_CAST(int, n));
+	}
+
+	// Add d to the extents of the ancestors of node i.  Going backwards from i,
+	// each node on a higher level than the last one we found is an ancestor.
+	void resize(unsigned int i, int d)
+	{
+		for (int k = i - 1, l = lvl[i]; k >= 0 && l > 0; k--)
+		{
+			if (lvl[k] < l)
+			{
+				ext[k] += d;
+				l = lvl[k];
+			}
+		}
+	}
+
+	// Figure out the extents from the levels.  A subtree ends at the first
+	// node that is not on a lower level than its root.
+	void extents()
+	{
+		std::vector<int> open;
+		ext.assign(lvl.size(), 1);
+		for (int k = 0; k <= STA_CAST(int, lvl.size()); k++)
+		{
+			while (!open.empty() &&
+				   (k == STA_CAST(int, lvl.size()) || lvl[open.back()] >= lvl[k]))
+			{
+				ext[open.back()] = k - open.back();
+				open.pop_back();
+			}
+			if (k < STA_CAST(int, lvl.size()))
+				open.push_back(k);
+		}
+	}
+
+	// Turn [a, a+na) [a+na, b) [b, b+nb) into [b, b+nb) [a+na, b) [a, a+na).
+	template <class V>
+	static void rotate(std::vector<V> &v, unsigned int a, int na, unsigned int b,
+					   int nb)
+	{
+		std::rotate(v.begin() + a, v.begin() + b, v.begin() + b + nb);
+		std::rotate(v.begin() + a + nb, v.begin() + a + nb + na,
+					v.begin() + b + nb);
+	}
+
+	// Replace n elements of v at i with m elements of w at j.
+	template <class V>
+	static void splice(std::vector<V> &v, unsigned int i, int n,
+					   const std::vector<V> &w, unsigned int j, int m)
+	{
+		int common = std::min(n, m);
+		std::copy(w.begin() + j, w.begin() + j + common, v.begin() + i);
+		if (n > m)
+			v.erase(v.begin() + i + m, v.begin() + i + n);
+		else
+			v.insert(v.begin() + i + n, w.begin() + j + n, w.begin() + j + m);
+	}
+};
+
+// Compare the rows of siblings [i, iend) of a and [j, jend) of b and count the
+// places where one node has children and the other does not.  Like
+// _GATreeCompare, we go through the row of a and wrap around the row of b if
+// it is shorter.
+template <class T>
+int _GAFlatTreeCompare(const GAFlatTree<T> &a, unsigned int i, unsigned int iend,
+					   const GAFlatTree<T> &b, unsigned int j, unsigned int jend)
+{
+	if (i == iend && j == jend)
+		return 0;
+	if (i == iend || j == jend)
+		return 1;
+	int count = 0;
+	for (unsigned int x = i, y = j; x < iend; x = a.skip(x))
+	{
+		count += _GAFlatTreeCompare(a, x + 1, a.skip(x), b, y + 1, b.skip(y));
+		y = b.skip(y);
+		if (y >= jend)
+			y = j;
+	}
+	return count;
+}
+
+#endif
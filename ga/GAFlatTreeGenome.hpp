@@ -0,0 +1,306 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  flattreegenome.h
+
+ DESCRIPTION:
+  This header defines the interface for the flat tree genome.
+---------------------------------------------------------------------------- */
+#ifndef _ga_flattreegenome_h_
+#define _ga_flattreegenome_h_
+
+#include <GAFlatTree.hpp>
+#include <GAGenome.h>
+#include <garandom.h>
+
+/* ----------------------------------------------------------------------------
+FlatTreeGenome
+-------------------------------------------------------------------------------
+  This is the tree genome on top of the flat tree instead of the linked tree.
+It has the same operators as GATreeGenome and they do the same things with the
+same random numbers, so a flat tree genome built like a tree genome evolves the
+same way.  Use it when the objective walks the whole tree (a GP-style
+interpreter, for example):  the nodes are in depth-first order in one array,
+so the objective reads them in order instead of chasing pointers.
+  Like the tree genome, the flat tree genome can grow without bound.
+---------------------------------------------------------------------------- */
+template <class T>
+class GAFlatTreeGenome : public GAFlatTree<T>, public GAGenome
+{
+  public:
+	GADefineIdentity("GAFlatTreeGenome", GAID::FlatTreeGenome);
+
+	// Each node has a pmut chance of being cut out of the tree along with its
+	// subtree.  Nodes that are already gone are skipped.
+	static int DestructiveMutator(GAGenome &c, float pmut)
+	{
+		GAFlatTreeGenome<T> &child = DYN_CAST(GAFlatTreeGenome<T> &, c);
+		if (pmut <= 0.0)
+			return 0;
+
+		int n = child.size();
+		float nMut = pmut * STA_CAST(float, n);
+		if (nMut < 1.0)
+		{ // we have to do a flip test for each node
+			nMut = 0;
+			for (int i = 0; i < n; i++)
+			{
+				if (GAFlipCoin(pmut) && i < child.size())
+				{
+					child.destroy(i);
+					nMut++;
+				}
+			}
+		}
+		else
+		{ // only nuke the number of nodes we need to
+			for (int i = 0; i < nMut; i++)
+			{
+				int k = GARandomInt(0, n - 1);
+				if (k < child.size())
+					child.destroy(k);
+			}
+		}
+		return (STA_CAST(int, nMut));
+	}
+
+	// Swap the contents of pairs of nodes.  The shape does not change.
+	static int SwapNodeMutator(GAGenome &c, float pmut)
+	{
+		GAFlatTreeGenome<T> &child = DYN_CAST(GAFlatTreeGenome<T> &, c);
+		if (pmut <= 0.0)
+			return 0;
+
+		int n = child.size();
+		float nMut = pmut * STA_CAST(float, n);
+		nMut *= 0.5; // swapping one node swaps another as well
+		if (nMut < 1.0)
+		{ // we have to do a flip test for each node
+			nMut = 0;
+			for (int i = 0; i < n; i++)
+			{
+				if (GAFlipCoin(pmut))
+				{
+					child.swap(i, GARandomInt(0, n - 1));
+					nMut++;
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < nMut; i++)
+				child.swap(GARandomInt(0, n - 1), GARandomInt(0, n - 1));
+		}
+		return (STA_CAST(int, nMut * 2));
+	}
+
+	// Swap pairs of subtrees.  As with the tree genome, a pair in which one
+	// node is an ancestor of the other is left alone, so the mutation rate is
+	// not exact.
+	static int SwapSubtreeMutator(GAGenome &c, float pmut)
+	{
+		GAFlatTreeGenome<T> &child = DYN_CAST(GAFlatTreeGenome<T> &, c);
+		if (pmut <= 0.0)
+			return 0;
+
+		int n = child.size();
+		float nMut = pmut * STA_CAST(float, n);
+		nMut *= 0.5; // swapping one node swaps another as well
+		if (nMut < 1.0)
+		{ // we have to do a flip test for each node
+			nMut = 0;
+			for (int i = 0; i < n; i++)
+			{
+				if (GAFlipCoin(pmut))
+				{
+					int b = GARandomInt(0, n - 1);
+					if (!child.ancestral(i, b))
+						child.swaptree(i, b);
+					nMut++;
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < nMut; i++)
+			{
+				int a = GARandomInt(0, n - 1);
+				int b = GARandomInt(0, n - 1);
+				if (!child.ancestral(a, b))
+					child.swaptree(a, b);
+			}
+		}
+		return (STA_CAST(int, nMut * 2));
+	}
+
+	// Replace a random subtree of one parent with a random subtree of the
+	// other.  Any node (including the root) can be a crossover site.
+	static int OnePointCrossover(const GAGenome &p1, const GAGenome &p2,
+								 GAGenome *c1, GAGenome *c2)
+	{
+		const GAFlatTreeGenome<T> &mom =
+			DYN_CAST(const GAFlatTreeGenome<T> &, p1);
+		const GAFlatTreeGenome<T> &dad =
+			DYN_CAST(const GAFlatTreeGenome<T> &, p2);
+
+		int nc = 0;
+		unsigned int a = GARandomInt(0, mom.size() - 1);
+		unsigned int b = GARandomInt(0, dad.size() - 1);
+		bool valid = (a < STA_CAST(unsigned int, mom.size()) &&
+					  b < STA_CAST(unsigned int, dad.size()));
+
+		if (c1 && c2)
+		{
+			GAFlatTreeGenome<T> &sis = DYN_CAST(GAFlatTreeGenome<T> &, *c1);
+			GAFlatTreeGenome<T> &bro = DYN_CAST(GAFlatTreeGenome<T> &, *c2);
+			if (valid)
+			{
+				sis.crossed(mom, a, dad, b);
+				bro.crossed(dad, b, mom, a);
+			}
+			nc = 2;
+		}
+		else if (c1)
+		{
+			GAFlatTreeGenome<T> &sis = DYN_CAST(GAFlatTreeGenome<T> &, *c1);
+			if (GARandomBit())
+			{
+				if (valid)
+					sis.crossed(mom, a, dad, b);
+			}
+			else
+			{
+				if (valid)
+					sis.crossed(dad, b, mom, a);
+			}
+			nc = 1;
+		}
+		return nc;
+	}
+
+	// Same measure as the tree genome:  walk the two trees together and count
+	// the places where one node has children and the other does not.  The
+	// contents of the nodes are not compared.
+	static float TopologyComparator(const GAGenome &a, const GAGenome &b)
+	{
+		if (&a == &b)
+			return 0;
+		const GAFlatTreeGenome<T> &sis = DYN_CAST(const GAFlatTreeGenome<T> &, a);
+		const GAFlatTreeGenome<T> &bro = DYN_CAST(const GAFlatTreeGenome<T> &, b);
+		return STA_CAST(float, _GAFlatTreeCompare(sis, 0, sis.size(), bro, 0, bro.size()));
+	}
+
+  public:
+	GAFlatTreeGenome(GAGenome::Evaluator f = nullptr, void *u = nullptr)
+		: GAFlatTree<T>(),
+		  GAGenome(DEFAULT_TREE_INITIALIZER, DEFAULT_TREE_MUTATOR,
+				   DEFAULT_TREE_COMPARATOR)
+	{
+		evaluator(f);
+		userData(u);
+		crossover(DEFAULT_TREE_CROSSOVER);
+	}
+
+	GAFlatTreeGenome(const GAFlatTreeGenome<T> &orig)
+		: GAFlatTree<T>(), GAGenome()
+	{
+		GAFlatTreeGenome<T>::copy(orig);
+	}
+
+	GAFlatTreeGenome<T> &operator=(const GAGenome &orig)
+	{
+		copy(orig);
+		return *this;
+	}
+	~GAFlatTreeGenome() override = default;
+
+	GAGenome *
+	clone(GAGenome::CloneMethod flag = CloneMethod::CONTENTS) const override
+	{
+		auto *cpy = new GAFlatTreeGenome<T>();
+		if (flag == CloneMethod::CONTENTS)
+		{
+			cpy->copy(*this);
+		}
+		else
+		{
+			cpy->GAGenome::copy(*this);
+		}
+		return cpy;
+	}
+
+	void copy(const GAGenome &orig) override
+	{
+		if (&orig == this)
+			return;
+		const GAFlatTreeGenome<T> *c = DYN_CAST(const GAFlatTreeGenome<T> *, &orig);
+		if (c)
+		{
+			GAGenome::copy(*c);
+			GAFlatTree<T>::copy(*c);
+		}
+	}
+
+	// Write the shape of the tree, one node per line, indented by level.
+	int write(std::ostream &os) const override
+	{
+		for (int i = 0; i < this->size(); i++)
+		{
+			for (unsigned int l = 0; l < this->level(i); l++)
+				os << "  ";
+			os << i << " (" << this->extent(i) << ")\n";
+		}
+		return 0;
+	}
+
+	bool equal(const GAGenome &c) const override
+	{
+		if (this == &c)
+			return true;
+		const GAFlatTreeGenome<T> &b = DYN_CAST(const GAFlatTreeGenome<T> &, c);
+		return _GAFlatTreeCompare(*this, 0, this->size(), b, 0, b.size()) == 0;
+	}
+
+	// Here we do versions of the modifiers of the flat tree so that we can
+	// unset the _evaluated flag.
+
+	int insert(const T &t)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::insert(t);
+	}
+	int insert(const T &t, unsigned int p)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::insert(t, p);
+	}
+	int destroy(unsigned int i)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::destroy(i);
+	}
+	int swap(unsigned int i, unsigned int j)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::swap(i, j);
+	}
+	int swaptree(unsigned int i, unsigned int j)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::swaptree(i, j);
+	}
+	int replace(unsigned int i, const GAFlatTree<T> &t, unsigned int j)
+	{
+		_evaluated = false;
+		return GAFlatTree<T>::replace(i, t, j);
+	}
+
+  protected:
+	void crossed(const GAFlatTree<T> &x, unsigned int i, const GAFlatTree<T> &y,
+				 unsigned int j)
+	{
+		_evaluated = false;
+		GAFlatTree<T>::cross(x, i, y, j);
+	}
+};
+
+#endif
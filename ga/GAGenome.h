@@ -21,6 +21,7 @@ it should operate on the data.  See comments below for further details.
 
 #include <istream>
 #include <ostream>
+#include <vector>
 
 class GAGeneticAlgorithm;
 class GAGenome;
@@ -63,7 +64,9 @@ selected to cross with itself, and self-copying is not out of the question)
 
 	When you derive a genome, don't forget to use the _evaluated flag to
   indicate when the state of the genome has changed and an evaluation is
-  needed.
+  needed.  If your genome has elements that are set one at a time, you can
+  call logChange(i) instead when element i changes so that the genome can be
+  given to a delta evaluator (see below).
 	Assign a default crossover method so that users don't have to assign one
   unless they want to.  Do this in the constructor.
 	It is a good idea to define an identity for your genome (especially if
@@ -124,6 +127,16 @@ crossover
   The genetic algorithm must actually perform the mating because it involves
   another genome (as parent and/or child).
 
+uncheckedMutator, uncheckedCrossover
+  Each built-in operator casts its arguments to the genome type it works on
+  (and the cast is checked on every call), then calls the typed version of the
+  operator which takes the genome type itself.  These members return the
+  operator that skips the checks for one of the built-in operators of the
+  genome, or nil if the genome does not know the operator.  The genetic
+  algorithms make sure that all of the genomes in the population have the same
+  class (by classID) when they are initialized and then use the unchecked
+  operators.  Operators that you define yourself are always called as is.
+
 evaluator
   Set the genome's objective function.  This also sets marks the evaluated
   flag to indicate that the genome must be re-evaluated.
@@ -135,6 +148,23 @@ evaluator
 	The genome objective function is used by the GA to evaluate each member of
   the population.
 
+deltaEvaluator
+  Set a function that updates the score from the changes made since the last
+  evaluation instead of evaluating the whole genome.  It gets the previous
+  score and the positions of the elements that changed (each one once), and
+  returns the new score.  For example, if a mutation flips 3 bits of a 1000-bit
+  string whose score is the number of 1s, the delta evaluator looks at 3 bits
+  rather than 1000.  The genomes that keep the changes (the 1D binary string
+  and the 1D array) also tell you what each changed element used to be.
+	The changes are only kept while the genome has a score it can trust and a
+  delta evaluator, and only up to MAX_CHANGES of them.  Anything else (more
+  changes, a crossover that rebuilds the genome, a resize, evaluate(true))
+  means the objective function is used as usual.  A copy gets the score and
+  the changes of the original, so a child that is copied from its parent and
+  then mutated is updated from the parent's score.
+	An operator that writes many elements at once can check logsChanges()
+  and skip the log altogether when it is off.
+
 comparator
   This method is used to determine how similar two genomes are.  If you want
   to use a different comparison method without deriving a new class, then use
@@ -204,6 +234,8 @@ class GAGenome : public GAID
 	using Comparator = float (*)(const GAGenome &, const GAGenome &);
 	using SexualCrossover = int (*)(const GAGenome &, const GAGenome &, GAGenome *, GAGenome *);
 	using AsexualCrossover = int (*)(const GAGenome &, GAGenome *);
+	using DeltaEvaluator = float (*)(GAGenome &, float previous,
+									 const unsigned int *changed, int nchanged);
 
   public:
 	static void NoInitializer(GAGenome &);
@@ -228,6 +260,7 @@ class GAGenome : public GAID
 		FIXED_SIZE = -1,
 		ANY_SIZE = -10
 	};
+	static constexpr int MAX_CHANGES = 64; // longest change log
 
   public:
 	// The GNU compiler sucks.  It won't recognize No*** as a member of the
@@ -268,6 +301,7 @@ class GAGenome : public GAID
 
   public:
 	int nevals() const { return _neval; }
+	bool isEvaluated() const { return _evaluated && _changes.empty(); }
 	float score() const
 	{
 		evaluate();
@@ -276,6 +310,7 @@ class GAGenome : public GAID
 	float score(float s)
 	{
 		_evaluated = true;
+		_changes.clear();
 		return _score = s;
 	}
 	float fitness() { return _fitness; }
@@ -305,10 +340,20 @@ class GAGenome : public GAID
 		_evaluated = false;
 		return (eval = f);
 	}
+	DeltaEvaluator deltaEvaluator() const { return deval; }
+	DeltaEvaluator deltaEvaluator(DeltaEvaluator f)
+	{
+		_evaluated = false;
+		return (deval = f);
+	}
+	int nchanges() const { return STA_CAST(int, _changes.size()); }
+	bool logsChanges() const { return _evaluated && deval != nullptr; }
+	const unsigned int *changes() const { return _changes.data(); }
 
 	void initialize()
 	{
 		_evaluated = false;
+		_changes.clear();
 		_neval = 0;
 		(*init)(*this);
 	}
@@ -328,6 +373,12 @@ class GAGenome : public GAID
 	AsexualCrossover crossover(AsexualCrossover f) { return asexcross = f; }
 	AsexualCrossover asexual() const { return asexcross; }
 
+	virtual Mutator uncheckedMutator(Mutator) const { return nullptr; }
+	virtual SexualCrossover uncheckedCrossover(SexualCrossover) const
+	{
+		return nullptr;
+	}
+
   protected:
 	float _score; // value returned by the objective function
 	float _fitness; // (possibly scaled) fitness score
@@ -343,6 +394,67 @@ class GAGenome : public GAID
 
 	SexualCrossover sexcross; // preferred sexual mating method
 	AsexualCrossover asexcross; // preferred asexual mating method
+	DeltaEvaluator deval; // update the score from the changes
+	std::vector<unsigned int> _changes; // elements changed since evaluation
+
+	// Element i is about to change.  Returns the slot of i in the change log
+	// if this is the first change to i since the last evaluation (so the
+	// caller can keep the old value there), otherwise -1.  If the change
+	// cannot be logged the genome simply needs a full evaluation.
+	int logChange(unsigned int i)
+	{
+		if (!_evaluated || deval == nullptr)
+		{
+			_evaluated = false;
+			return -1;
+		}
+		for (unsigned int c : _changes)
+			if (c == i)
+				return -1;
+		if (_changes.size() == STA_CAST(std::size_t, MAX_CHANGES))
+		{
+			_changes.clear();
+			_evaluated = false;
+			return -1;
+		}
+		_changes.push_back(i);
+		return STA_CAST(int, _changes.size()) - 1;
+	}
+	int changeSlot(unsigned int i) const
+	{
+		for (std::size_t k = 0; k < _changes.size(); k++)
+			if (_changes[k] == i)
+				return STA_CAST(int, k);
+		return -1;
+	}
+};
+
+/* ----------------------------------------------------------------------------
+  The unchecked operators are made from the typed operators with these
+templates.  They use a static cast, so they must only be called on genomes that
+are known to be of type G (or derived from it).  Use them in uncheckedMutator
+and uncheckedCrossover, for example
+
+	if (f == FlipMutator)
+		return GATypedOperators<MyGenome>::mutator<TypedFlipMutator>;
+---------------------------------------------------------------------------- */
+template <class G> class GATypedOperators
+{
+  public:
+	using Mutator = int (*)(G &, float);
+	using SexualCrossover = int (*)(const G &, const G &, G *, G *);
+
+	template <Mutator f> static int mutator(GAGenome &g, float pmut)
+	{
+		return (*f)(STA_CAST(G &, g), pmut);
+	}
+	template <SexualCrossover f>
+	static int crossover(const GAGenome &p1, const GAGenome &p2, GAGenome *c1,
+						 GAGenome *c2)
+	{
+		return (*f)(STA_CAST(const G &, p1), STA_CAST(const G &, p2),
+					STA_CAST(G *, c1), STA_CAST(G *, c2));
+	}
 };
 
 inline std::ostream &operator<<(std::ostream &os, const GAGenome &genome)
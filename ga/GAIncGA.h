@@ -68,6 +68,7 @@ public:
 
   void objectiveFunction(GAGenome::Evaluator f) override;
   void objectiveData(const GAEvalData& v) override;
+  void recycle(const GAGenome &) override;
 
   int nOffspring() const {return noffspr;}
   int nOffspring(unsigned int);
@@ -32,9 +32,9 @@ careful so that you don't end up with an iterator dangling with a pointer to
 a part of a list that no longer exists (I would need some kind of reference
 counting and/or message passing to take care of this at a lower level, and I'm
 not ready to implement that at this point).
-  For now we allocate nodes on the fly.  Eventually I would like to do some
-better memory management (arrays perhaps?) so we don't have to do so much
-alloc and dealloc and recursion.
+  The nodes come from the node pool (see GANodePool.h), so allocating and
+freeing them is cheap and the nodes of a copied list sit next to each other in
+memory.
   We depend on the template-ized GAListIter routine, thus the declaration.
 
 copy
@@ -70,14 +70,15 @@ extern GANodeBASE *_GAListTraverse(unsigned int index, unsigned int &cur,
 
 // Copy a node, including all of its siblings up to the end of the list.  We do
 // NOT wrap around the list until we return the first node - we stop at the
-// tail of the list.  Return the pointer to the first node in the list.
+// tail of the list.  Return the pointer to the first node in the list.  Every
+// node in a GAList<T> is a GANode<T>, so we do not need to check the casts.
 template <class T> GANode<T> *_GAListCopy(GANode<T> *node, GANode<T> *head)
 {
 	if (!node)
 		return nullptr;
 	auto *newnode = new GANode<T>(node->contents);
 	GANode<T> *lasttmp = newnode, *newtmp = nullptr;
-	GANode<T> *tmp = DYN_CAST(GANode<T> *, node->next);
+	GANode<T> *tmp = STA_CAST(GANode<T> *, node->next);
 	while (tmp && tmp != head)
 	{
 		newtmp = new GANode<T>(tmp->contents);
@@ -85,7 +86,7 @@ template <class T> GANode<T> *_GAListCopy(GANode<T> *node, GANode<T> *head)
 		lasttmp->next = newtmp;
 
 		lasttmp = newtmp;
-		tmp = DYN_CAST(GANode<T> *, tmp->next);
+		tmp = STA_CAST(GANode<T> *, tmp->next);
 	}
 	if (newtmp)
 	{
@@ -121,7 +122,7 @@ template <class T> class GAList : public GAListBASE
 	virtual ~GAList()
 	{
 		while (hd)
-			delete GAListBASE::remove(DYN_CAST(GANode<T> *, hd));
+			delete GAListBASE::remove(STA_CAST(GANode<T> *, hd));
 		iter.node = nullptr;
 	}
 
@@ -137,13 +138,13 @@ template <class T> class GAList : public GAListBASE
 		GANode<T> *node;
 		unsigned int w = 0;
 		if (i == 0)
-			node = DYN_CAST(GANode<T> *, hd);
+			node = STA_CAST(GANode<T> *, hd);
 		else
-			node = DYN_CAST(GANode<T> *, _GAListTraverse(i, w, hd));
+			node = STA_CAST(GANode<T> *, _GAListTraverse(i, w, hd));
 		if (!node)
 			return t;
 
-		GANode<T> *newnode = _GAListCopy(node, DYN_CAST(GANode<T> *, hd));
+		GANode<T> *newnode = _GAListCopy(node, STA_CAST(GANode<T> *, hd));
 
 		t->insert(newnode, nullptr, GAListBASE::HEAD);
 
@@ -163,9 +164,9 @@ template <class T> class GAList : public GAListBASE
 	void copy(const GAList<T> &orig)
 	{
 		while (hd)
-			delete GAListBASE::remove(DYN_CAST(GANode<T> *, hd));
-		hd = _GAListCopy(DYN_CAST(GANode<T> *, orig.hd),
-						 DYN_CAST(GANode<T> *, orig.hd));
+			delete GAListBASE::remove(STA_CAST(GANode<T> *, hd));
+		hd = _GAListCopy(STA_CAST(GANode<T> *, orig.hd),
+						 STA_CAST(GANode<T> *, orig.hd));
 		iter.node = hd;
 		sz = orig.sz;
 		csz = orig.csz;
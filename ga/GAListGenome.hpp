@@ -11,11 +11,14 @@
 #ifndef _ga_list_h_
 #define _ga_list_h_
 
+#include <GAEdgeRecombination.hpp>
 #include <GAGenome.h>
 #include <GAList.hpp>
 #include <GAMask.h>
 #include <garandom.h>
 
+#include <vector>
+
 /* ----------------------------------------------------------------------------
 ListGenome
 -------------------------------------------------------------------------------
@@ -250,7 +253,7 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 		const GAListGenome<T> &mom = DYN_CAST(const GAListGenome<T> &, p1);
 		const GAListGenome<T> &dad = DYN_CAST(const GAListGenome<T> &, p2);
 
-		if (mom.size() != dad.size())
+		if (GA_CHECK(mom.size() != dad.size()))
 		{
 			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
 			return 0;
@@ -320,7 +323,7 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 		const GAListGenome<T> &mom = DYN_CAST(const GAListGenome<T> &, p1);
 		const GAListGenome<T> &dad = DYN_CAST(const GAListGenome<T> &, p2);
 
-		if (mom.size() != dad.size())
+		if (GA_CHECK(mom.size() != dad.size()))
 		{
 			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
 			return 0;
@@ -447,7 +450,7 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 		const GAListGenome<T> &mom = DYN_CAST(const GAListGenome<T> &, p1);
 		const GAListGenome<T> &dad = DYN_CAST(const GAListGenome<T> &, p2);
 
-		if (mom.size() != dad.size())
+		if (GA_CHECK(mom.size() != dad.size()))
 		{
 			GAErr(GA_LOC, mom.className(), "cross", GAError::BadParentLength);
 			return 0;
@@ -535,6 +538,71 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 		return nc;
 	}
 
+	// Edge recombination for lists of integers that are tours (see
+	// GAEdgeRecombination).  We copy the parents into arrays, build each child
+	// there, then copy it back into the child's nodes.
+	static int EdgeRecombinationCrossover(const GAGenome &p1, const GAGenome &p2,
+										  GAGenome *c1, GAGenome *c2)
+	{
+		const GAListGenome<T> &mom = DYN_CAST(const GAListGenome<T> &, p1);
+		const GAListGenome<T> &dad = DYN_CAST(const GAListGenome<T> &, p2);
+		if (GA_CHECK(mom.size() != dad.size()))
+		{
+			GAErr(GA_LOC, mom.className(), "edge recombination cross",
+				  GAError::BadParentLength);
+			return 0;
+		}
+
+		static thread_local std::vector<T> x, y, tour;
+		GAListContents(mom, x);
+		GAListContents(dad, y);
+		tour.resize(x.size());
+		int nc = 0;
+		if (c1)
+		{
+			if (!GAEdgeRecombination(x.data(), y.data(), mom.size(), tour.data()))
+			{
+				GAErr(GA_LOC, mom.className(), "edge recombination cross",
+					  GAError::BadTour);
+				return nc;
+			}
+			DYN_CAST(GAListGenome<T> &, *c1).GAListFill(tour);
+			nc += 1;
+		}
+		if (c2)
+		{
+			if (!GAEdgeRecombination(y.data(), x.data(), mom.size(), tour.data()))
+			{
+				GAErr(GA_LOC, mom.className(), "edge recombination cross",
+					  GAError::BadTour);
+				return nc;
+			}
+			DYN_CAST(GAListGenome<T> &, *c2).GAListFill(tour);
+			nc += 1;
+		}
+		return nc;
+	}
+
+	// The number of edges of one tour that the other does not have (see
+	// GAEdgeDistance).  Unlike the node comparator, this gives full credit to
+	// the same tour from a different starting town or in the other direction.
+	static float EdgeComparator(const GAGenome &a, const GAGenome &b)
+	{
+		if (&a == &b)
+			return 0;
+		const GAListGenome<T> &sis = DYN_CAST(const GAListGenome<T> &, a);
+		const GAListGenome<T> &bro = DYN_CAST(const GAListGenome<T> &, b);
+		if (sis.size() > bro.size())
+			return (float)(sis.size() - bro.size());
+		if (sis.size() < bro.size())
+			return (float)(bro.size() - sis.size());
+
+		static thread_local std::vector<T> x, y;
+		GAListContents(sis, x);
+		GAListContents(bro, y);
+		return (float)GAEdgeDistance(x.data(), y.data(), sis.size());
+	}
+
   public:
 	GAListGenome(GAGenome::Evaluator f = nullptr, void *u = nullptr)
 		: GAList<T>(), GAGenome(DEFAULT_LIST_INITIALIZER, DEFAULT_LIST_MUTATOR,
@@ -677,6 +745,39 @@ template <class T> class GAListGenome : public GAList<T>, public GAGenome
 	}
 
   private:
+	// Copy the contents of a list into an array, starting at the head.
+	static void GAListContents(const GAListGenome<T> &list, std::vector<T> &v)
+	{
+		GAListIter<T> iter(list);
+		v.resize(list.size());
+		T *t = iter.head();
+		for (std::size_t i = 0; i < v.size(); i++, t = iter.next())
+			v[i] = *t;
+	}
+
+	// Make the list hold the contents of the array.  If the list is already
+	// the right size we just overwrite the nodes.
+	void GAListFill(const std::vector<T> &v)
+	{
+		if (this->size() != STA_CAST(int, v.size()))
+		{
+			while (this->head())
+				destroy();
+			for (const T &t : v)
+				insert(t, GAListBASE::TAIL);
+		}
+		else if (this->head())
+		{
+			for (const T &t : v)
+			{
+				*this->current() = t;
+				this->next();
+			}
+		}
+		_evaluated = false;
+		this->head(); // set iterator to head of list
+	}
+
 	// Order crossover for lists.  As described in Goldberg's book.
 	//   We assume that we'll never get a NULL pointer while iterating through
 	//   the
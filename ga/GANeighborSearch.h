@@ -0,0 +1,95 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GANeighborSearch.h
+
+ DESCRIPTION:
+  Find the points that are within some distance of a point without looking
+at all of the others.  The niching schemes use this to find the neighbours of
+each genome when the genomes can be mapped to points (an 'embedding'), so that
+they do not have to compare every genome with every other one.
+
+  The points are n rows of dim floats.  The distance between two points is
+
+	EUCLIDEAN   the square root of the sum of the squared differences
+	MANHATTAN   the sum of the absolute differences
+	HAMMING     the fraction of the coordinates that are different (a
+	            coordinate is 1 if it is not 0), which is what the bit
+	            string comparators return
+
+build
+  Index the points for searches out to the given radius (it is only the
+  Hamming index that needs to know the radius).  The points are copied.  The
+  Euclidean and Manhattan points go into a k-d tree.  The Hamming points are
+  packed into bits and split into radius*dim+1 blocks:  two points that are
+  within the radius have at least one block in common, so we only look at the
+  points that share a block (multi-index hashing).  When there are too few
+  bits in each block for that to pay, we compare the bits of every pair
+  instead.
+
+neighbors
+  Put the index and the distance of every point that is closer than radius to
+  point i (including i itself) into the list, in order of index.  The radius
+  may not be bigger than the one the index was built for.  The search is exact
+  and can be done by several threads at once.
+
+distance
+  The distance between points i and j.
+---------------------------------------------------------------------------- */
+#ifndef _ga_neighborsearch_h_
+#define _ga_neighborsearch_h_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class GANeighborSearch
+{
+  public:
+	enum Metric
+	{
+		EUCLIDEAN,
+		MANHATTAN,
+		HAMMING
+	};
+	using Neighbors = std::vector<std::pair<int, float>>;
+
+	GANeighborSearch() : n(0), dim(0), metric(EUCLIDEAN), nwords(0) {}
+
+	void build(const float *points, int n, int dim, Metric m, float radius);
+	void neighbors(int i, float radius, Neighbors &list) const;
+	float distance(int i, int j) const;
+
+	int size() const { return n; }
+	int dimension() const { return dim; }
+
+  protected:
+	// A node of the k-d tree.  The points of a leaf are order[begin..end).
+	// Points in the left subtree have x[axis] <= split, in the right one
+	// x[axis] >= split.
+	struct Node
+	{
+		int begin, end;
+		int axis;
+		float split;
+		int left, right; // -1 for a leaf
+	};
+
+	int n, dim;
+	Metric metric;
+	std::vector<float> x; // the points (Euclidean and Manhattan)
+	std::vector<int> order; // the points of the tree, leaf by leaf
+	std::vector<Node> nodes; // the tree (the root is the first one)
+
+	int nwords; // words of bits per point (Hamming)
+	std::vector<std::uint64_t> bits; // the points as bits
+	std::vector<int> blockStart; // first bit of each block, and then dim
+	std::vector<std::vector<std::pair<std::uint64_t, int>>> tables;
+	// for each block, the (hash of the block, point) pairs in hash order
+
+	int makeTree(int begin, int end);
+	void searchTree(int node, int i, float radius, Neighbors &list) const;
+	std::uint64_t blockHash(int i, int block) const;
+	int differentBits(int i, int j) const;
+};
+
+#endif
@@ -11,7 +11,9 @@
 #define _ga_node_h_
 
 #include <gaconfig.h>
+#include <GANodePool.h>
 
+#include <cstddef>
 #include <ostream>
 
 /* ----------------------------------------------------------------------------
@@ -76,6 +78,9 @@ reassigned).  We do not allow the nodes to be created without any arguments.
 	   operator=
   The node always owns its contents; when the node is destroyed, the contents
 of the node get destroyed as well.
+  The memory for the nodes comes from the node pool (unless GALIB_NO_NODE_POOL
+is defined), so new and delete of a node are cheap.  Nodes of classes derived
+from this one are allocated as usual.
 ---------------------------------------------------------------------------- */
 template <class T> struct GANode : public GANodeBASE
 {
@@ -88,6 +93,28 @@ template <class T> struct GANode : public GANodeBASE
 		contents = t;
 		return contents;
 	}
+
+#if defined(GALIB_USE_NODE_POOL)
+	// The class is complete in the member functions, so the size of the node is
+	// known there (but not in the class declaration itself).
+	static void *operator new(std::size_t n)
+	{
+		using Pool = GANodePool<sizeof(GANode<T>), alignof(GANode<T>)>;
+		return (n == sizeof(GANode<T>)) ? Pool::allocate() : ::operator new(n);
+	}
+	static void operator delete(void *p, std::size_t n)
+	{
+		using Pool = GANodePool<sizeof(GANode<T>), alignof(GANode<T>)>;
+		if (n == sizeof(GANode<T>))
+		{
+			Pool::deallocate(p);
+		}
+		else
+		{
+			::operator delete(p);
+		}
+	}
+#endif
 };
 
 template <class T> std::ostream &operator<<(std::ostream &os, GANode<T> &arg)
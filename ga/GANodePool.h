@@ -0,0 +1,214 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  nodepool.h
+
+ DESCRIPTION:
+  This defines the memory pool for the list and tree nodes.
+---------------------------------------------------------------------------- */
+#ifndef _ga_nodepool_h_
+#define _ga_nodepool_h_
+
+#include <gaconfig.h>
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/* ----------------------------------------------------------------------------
+ GANodePool
+-------------------------------------------------------------------------------
+  The lists and trees allocate and free a node every time they insert, remove,
+copy or clone something, and most of the list and tree operators do all of
+these.  Instead of going to the system allocator each time, the nodes come from
+large blocks (slabs) of memory that are carved into node-sized pieces and kept
+on a free list.  Allocating or freeing a node is then a couple of pointer
+operations, and the nodes of a list or tree that was built in one go end up
+next to each other in memory.
+  There is one pool for each node size, shared by every list and tree with
+nodes of that size.  This matters because nodes move from one list to another
+(the list and tree crossovers clone part of a parent and insert it into a
+child), so a node may be freed by a different container than the one that
+allocated it.
+  Each thread has its own free list, so the pool needs no locking except when
+a thread needs more nodes or has too many.  A thread keeps at most a couple of
+slabs' worth of free nodes; when it frees more than that (because it frees the
+nodes that another thread allocates, say) it hands a slab's worth back to the
+pool for the other threads.  The nodes that are on the free list of a thread
+when it exits are handed back too, whether or not the thread ever allocated
+any.  The slabs are never released, so a pool holds about as much memory as
+the largest number of nodes of its size that were in use at the same time,
+plus the free nodes that the threads keep.
+
+allocate, deallocate
+  Get a node-sized piece of memory from the pool and give it back.  The memory
+  is not initialized (use placement new, or let the operator new of GANode do
+  it for you).
+
+nSlabs
+  The number of slabs that the pool has carved up so far.
+---------------------------------------------------------------------------- */
+template <std::size_t Size, std::size_t Align> class GANodePool
+{
+  public:
+	static void *allocate()
+	{
+		Cache &c = cache();
+		if (c.free == nullptr)
+		{
+			refill(c);
+		}
+		Link *p = c.free;
+		c.free = p->next;
+		c.count--;
+		return p;
+	}
+	static void deallocate(void *p)
+	{
+		Cache &c = cache();
+		auto *l = static_cast<Link *>(p);
+		l->next = c.free;
+		c.free = l;
+		if (++c.count > LIMIT)
+		{
+			spill(c);
+		}
+	}
+	static std::size_t nSlabs()
+	{
+		Shared &s = shared();
+		std::lock_guard<std::mutex> guard(s.lock);
+		return s.slabs.size();
+	}
+
+  private:
+	struct Link
+	{
+		Link *next;
+	};
+
+	static constexpr std::size_t ALIGN =
+		(Align > alignof(Link) ? Align : alignof(Link));
+	static constexpr std::size_t BLOCK =
+		((Size > sizeof(Link) ? Size : sizeof(Link)) + ALIGN - 1) / ALIGN * ALIGN;
+	// about 64K per slab, but never less than a few nodes
+	static constexpr std::size_t SLAB =
+		(BLOCK * 16 > 65536 ? 16 : 65536 / BLOCK);
+	// the most free nodes that a thread keeps for itself
+	static constexpr std::size_t LIMIT = 2 * SLAB;
+
+	// The free list of a thread.  This is trivially destructible so that it is
+	// still usable by containers that are destroyed after the thread-local
+	// objects of the thread (static lists and trees, for example).
+	struct Cache
+	{
+		Link *free;
+		std::size_t count; // how many nodes are on the free list
+	};
+
+	// Give the free list of a thread back to the pool when the thread exits.
+	struct Reaper
+	{
+		~Reaper()
+		{
+			Cache &c = cache();
+			if (c.free == nullptr)
+			{
+				return;
+			}
+			Link *tail = c.free;
+			while (tail->next != nullptr)
+			{
+				tail = tail->next;
+			}
+			Shared &s = shared();
+			std::lock_guard<std::mutex> guard(s.lock);
+			tail->next = s.orphans;
+			s.orphans = c.free;
+			c.free = nullptr;
+			c.count = 0;
+		}
+	};
+
+	// Every thread that touches the pool, whether to allocate or to free, gets
+	// a reaper.
+	static Cache &cache()
+	{
+		thread_local Cache c = {nullptr, 0};
+		thread_local Reaper reaper;
+		(void)reaper;
+		return c;
+	}
+
+	// The memory that is shared by the threads.  This is allocated once and
+	// never destroyed so that it outlives every list and tree.
+	struct Shared
+	{
+		std::mutex lock;
+		std::vector<void *> slabs; // every slab we have ever allocated
+		Link *orphans = nullptr; // free nodes that no thread is keeping
+	};
+	static Shared &shared()
+	{
+		static Shared *s = new Shared;
+		return *s;
+	}
+
+	// Hand a slab's worth of the free nodes of this thread back to the pool.
+	static void spill(Cache &c)
+	{
+		Link *first = c.free;
+		Link *last = first;
+		for (std::size_t i = 1; i < SLAB; i++)
+		{
+			last = last->next;
+		}
+		c.free = last->next;
+		c.count -= SLAB;
+
+		Shared &s = shared();
+		std::lock_guard<std::mutex> guard(s.lock);
+		last->next = s.orphans;
+		s.orphans = first;
+	}
+
+	// Put more nodes on the free list of this thread.  Take up to a slab's
+	// worth of the orphans if there are any, otherwise carve up a new slab.
+	static void refill(Cache &c)
+	{
+		Shared &s = shared();
+		std::lock_guard<std::mutex> guard(s.lock);
+		if (s.orphans != nullptr)
+		{
+			Link *first = s.orphans;
+			Link *last = first;
+			std::size_t n = 1;
+			for (; n < SLAB && last->next != nullptr; n++)
+			{
+				last = last->next;
+			}
+			s.orphans = last->next;
+			last->next = c.free;
+			c.free = first;
+			c.count += n;
+			return;
+		}
+
+		void *slab =
+			::operator new(SLAB * BLOCK, static_cast<std::align_val_t>(ALIGN));
+		s.slabs.push_back(slab);
+
+		// Link the new nodes from last to first so that they come off the free
+		// list in address order.
+		auto *bytes = static_cast<char *>(slab);
+		for (std::size_t i = SLAB; i > 0; i--)
+		{
+			auto *l = reinterpret_cast<Link *>(bytes + (i - 1) * BLOCK);
+			l->next = c.free;
+			c.free = l;
+		}
+		c.count += SLAB;
+	}
+};
+
+#endif
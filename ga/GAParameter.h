@@ -14,9 +14,14 @@
 #include <gaconfig.h>
 #include <gatypes.h>
 
+#include <functional>
 #include <istream>
 #include <list>
 #include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 enum class ParType
 {
@@ -61,6 +66,7 @@ class GAParameter
 					: (t == ParType::POINTER ? val.pval : &val));
 	}
 	ParType type() const { return t; }
+	bool holds(const void *v) const;
 
   protected:
 	std::string fname;
@@ -82,10 +88,69 @@ class GAParameter
 list.  Don't ask.  You can traverse through the list to get the parameters that
 you need.  Be sure to check the type before you try to extract the value for
 any specific parameter in the list.
+   The list keeps an index of the full and short names, so finding a parameter
+by name does not have to look through the whole list.  The only way to put a
+parameter on the list is add, so the index is always up to date; you can look
+through the list but you cannot change it some other way.  If you are going
+to get or set a parameter over and over, get a handle for it once:
+
+	GAParameterHandle<float> pmut = list.handle<float>(gaNpMutation);
+	pmut.set(pmut.get() * 0.9);
+
+A handle of type int is good for INT and BOOLEAN parameters, float for FLOAT,
+double for DOUBLE and char for CHAR.  If there is no such parameter, or it is
+of another type, the handle is not valid.  The handles stay good as long as
+the list does.  Assigning another list to it keeps the handles to the
+parameters that the other list has too (they get its values); the handles to
+the ones that it does not have are no longer good.
+   A listener is a function that gets called with the parameter each time the
+value of a parameter in the list changes (through set, a handle, read, parse
+or readBinary).  The listeners of a list are not copied with it.
+   writeBinary and readBinary do what write and read do, but in a compact
+binary form that does not lose any precision (pointers are left out).
 ---------------------------------------------------------------------------- */
-class GAParameterList : public std::list<GAParameter>
+class GAParameterList;
+
+template <class T> class GAParameterHandle
+{
+  public:
+	GAParameterHandle() : list(nullptr), param(nullptr) {}
+
+	bool valid() const { return param != nullptr; }
+	const GAParameter &parameter() const { return *param; }
+	T get() const { return *static_cast<const T *>(param->value()); }
+	void set(T v);
+
+  protected:
+	friend class GAParameterList;
+	GAParameterHandle(GAParameterList *l, GAParameter *p) : list(l), param(p) {}
+
+	GAParameterList *list;
+	GAParameter *param;
+};
+
+class GAParameterList : protected std::list<GAParameter>
 {
   public:
+	using Listener = std::function<void(const GAParameter &)>;
+	using std::list<GAParameter>::value_type;
+	using std::list<GAParameter>::const_iterator;
+	using std::list<GAParameter>::size;
+	using std::list<GAParameter>::empty;
+
+	GAParameterList() = default;
+	GAParameterList(const GAParameterList &orig)
+		: std::list<GAParameter>(orig), nextListener(0)
+	{
+		reindex();
+	}
+	GAParameterList &operator=(const GAParameterList &orig);
+
+	const_iterator begin() const { return std::list<GAParameter>::cbegin(); }
+	const_iterator end() const { return std::list<GAParameter>::cend(); }
+	const GAParameter &front() const { return std::list<GAParameter>::front(); }
+	const GAParameter &back() const { return std::list<GAParameter>::back(); }
+
 	bool get(const std::string &name, void *) const;
 	bool set(const std::string &name, const void *);
 	bool set(const std::string &name, int v) { return set(name, (void *)&v); }
@@ -96,12 +161,49 @@ class GAParameterList : public std::list<GAParameter>
 	bool add(const std::string &fn, const std::string &sn, ParType, const void *);
 	bool parse(int &argc, char **argv, bool flag = true);
 
+	GAParameter *find(const std::string &name);
+	const GAParameter *find(const std::string &name) const;
+	template <class T> GAParameterHandle<T> handle(const std::string &name)
+	{
+		GAParameter *p = find(name);
+		if (p == nullptr || !holds(p->type(), static_cast<T *>(nullptr)))
+		{
+			p = nullptr;
+		}
+		return GAParameterHandle<T>(this, p);
+	}
+
+	int listen(const Listener &f);
+	void ignore(int id);
+	void assign(GAParameter &p, const void *v);
+
 	bool write(const char *filename) const;
 	bool write(std::ostream &os) const;
 	bool read(const std::string &filename, bool flag = true);
 	bool read(std::istream &is, bool flag = true);
+	bool writeBinary(std::ostream &os) const;
+	bool readBinary(std::istream &is);
+
+  protected:
+	std::unordered_map<std::string, GAParameter *> names; // both names
+	std::vector<std::pair<int, Listener>> listeners;
+	int nextListener = 0;
+
+	void reindex();
+	void index(GAParameter &p);
+	void change(GAParameter &p, const void *v);
+
+	static bool holds(ParType t, const int *) { return t == ParType::INT || t == ParType::BOOLEAN; }
+	static bool holds(ParType t, const char *) { return t == ParType::CHAR; }
+	static bool holds(ParType t, const float *) { return t == ParType::FLOAT; }
+	static bool holds(ParType t, const double *) { return t == ParType::DOUBLE; }
 };
 
+template <class T> void GAParameterHandle<T>::set(T v)
+{
+	list->assign(*param, &v);
+}
+
 inline std::ostream &operator<<(std::ostream &os, const GAParameterList &plist)
 {
 	plist.write(os);
@@ -235,16 +235,7 @@ class GAPopulation : public GAID
 	}
 
 	int nevals() const { return neval; }
-	void evaluate(bool flag = false)
-	{
-		if (evaluated == false || flag == true)
-		{
-			(*eval)(*this);
-			neval++;
-			scaled = statted = divved = rsorted = ssorted = false;
-		}
-		evaluated = true;
-	}
+	void evaluate(bool flag = false);
 	Evaluator evaluator() const { return eval; }
 	Evaluator evaluator(Evaluator e)
 	{
@@ -318,6 +309,7 @@ class GAPopulation : public GAID
 	GAGenome *add(const GAGenome &);
 	GAGenome *remove(int which = WORST, SortBasis basis = RAW);
 	GAGenome *remove(GAGenome *);
+	int removeWorst(GAGenome **removed, int count, SortBasis basis = RAW);
 	GAGenome *replace(GAGenome *, int which = RANDOM, SortBasis basis = RAW);
 	GAGenome *replace(GAGenome *newgenome, GAGenome *oldgenome);
 	void destroy(int w = WORST, SortBasis b = RAW) { delete remove(w, b); }
@@ -0,0 +1,117 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GARealESGenome.h
+
+ DESCRIPTION:
+  A real number genome for evolution strategies.  Each element carries a step
+size of its own, and the mutator changes the step sizes before it uses them
+(log-normal self-adaptation, as in Schwefel's strategies), so the genome
+learns how far to move each element.  The Gaussian mutator of the real genome
+always moves by about 1, which is far too much for an element whose range is
+1e-6 and far too little for one whose range is 1e4.
+  The step sizes are measured in the units of the elements.  They start as a
+fraction of the range of each element and are kept between a (smaller)
+fraction of it and the whole range.  An element whose allele set is not
+bounded has no range; it is mutated the way the flip mutator does it, and its
+step size is not used.
+  The step sizes go with the genome when it is copied or cloned, and the
+discrete crossover gives each child the mean of the step sizes of the parents.
+The other crossovers of the real genome work on this genome too, but they
+change only the elements, so the children keep whatever step sizes they had.
+The step sizes are not written or read, and they do not count when genomes
+are compared.
+
+UniformInitializer
+  Picks each element from its allele set and sets each step size to its
+  initial fraction of the range.
+
+SelfAdaptiveMutator
+  Multiplies each step size by exp(tau0 N + tau Ni) then adds a Gaussian of
+  that size to the element, where N is one normal number for the whole genome
+  and Ni one for each element (tau0 = 1/sqrt(2n), tau = 1/sqrt(2 sqrt(n))).
+  Every bounded element is mutated; the mutation probability only turns the
+  mutator on and off (and is the chance that an unbounded element is picked
+  again from its allele set).
+
+DiscreteCrossover
+  Each element of the sister comes from one parent or the other at random and
+  the brother gets the element of the other parent.  Both get the mean of the
+  step sizes of the parents.
+
+step
+  Get or set the step size of an element.
+
+range
+  The width of the allele set of an element (1 if the set is not bounded).
+
+initialStep
+  The step size that the initializer (and a resize) gives each element, as a
+  fraction of its range.  0.1 by default.
+
+minimumStep
+  The smallest step size, as a fraction of the range.  1e-6 by default.
+---------------------------------------------------------------------------- */
+#ifndef _ga_real_es_h_
+#define _ga_real_es_h_
+
+#include <GARealGenome.h>
+
+#include <vector>
+
+class GARealESGenome : public GARealGenome
+{
+  public:
+	GADefineIdentity("GARealESGenome", GAID::RealESGenome);
+
+	static void UniformInitializer(GAGenome &);
+	static int SelfAdaptiveMutator(GAGenome &, float);
+	static int TypedSelfAdaptiveMutator(GARealESGenome &, float);
+	static int DiscreteCrossover(const GAGenome &, const GAGenome &, GAGenome *,
+								 GAGenome *);
+	static int TypedDiscreteCrossover(const GARealESGenome &,
+									  const GARealESGenome &, GARealESGenome *,
+									  GARealESGenome *);
+
+  public:
+	GARealESGenome(unsigned int length, const GARealAlleleSet &s,
+				   GAGenome::Evaluator f = nullptr, void *u = nullptr);
+	explicit GARealESGenome(const GARealAlleleSetArray &sa,
+							GAGenome::Evaluator f = nullptr, void *u = nullptr);
+	GARealESGenome(const GARealESGenome &orig);
+	GARealESGenome &operator=(const GARealESGenome &arg)
+	{
+		copy(arg);
+		return *this;
+	}
+	GARealESGenome &operator=(const GAGenome &arg)
+	{
+		copy(arg);
+		return *this;
+	}
+	~GARealESGenome() override = default;
+	GAGenome *clone(GAGenome::CloneMethod flag = CloneMethod::CONTENTS) const override;
+	void copy(const GAGenome &) override;
+	int resize(int len) override;
+
+	GAGenome::Mutator uncheckedMutator(GAGenome::Mutator f) const override;
+	GAGenome::SexualCrossover
+	uncheckedCrossover(GAGenome::SexualCrossover f) const override;
+
+	float step(unsigned int i) const { return steps.at(i); }
+	float step(unsigned int i, float s) { return steps.at(i) = s; }
+	float range(unsigned int i) const;
+
+	float initialStep() const { return initStep; }
+	float initialStep(float fraction) { return initStep = fraction; }
+	float minimumStep() const { return minStep; }
+	float minimumStep(float fraction) { return minStep = fraction; }
+
+  protected:
+	std::vector<float> steps; // one for each element
+	float initStep{0.1F}; // fractions of the range
+	float minStep{1.0e-6F};
+
+	void resetSteps(unsigned int from);
+};
+
+#endif
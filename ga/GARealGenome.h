@@ -20,14 +20,32 @@ using GARealAlleleSetArray = GAAlleleSetArray<float>;
 
 using GARealGenome = GA1DArrayAlleleGenome<float>;
 
+// The table picks bounded real alleles itself.
+template <> float GAAlleleTable<float>::random(unsigned int) const;
+
+// The real genome has constructors of its own (for its default operators), so
+// code that derives from it must not get the ones of the template.
+template <>
+GA1DArrayAlleleGenome<float>::GA1DArrayAlleleGenome(unsigned int,
+	const GAAlleleSet<float> &, GAGenome::Evaluator, void *);
+template <>
+GA1DArrayAlleleGenome<float>::GA1DArrayAlleleGenome(
+	const GAAlleleSetArray<float> &, GAGenome::Evaluator, void *);
+template <> GA1DArrayAlleleGenome<float>::~GA1DArrayAlleleGenome();
+template <> int GA1DArrayAlleleGenome<float>::read(std::istream &);
+template <> const char *GA1DArrayAlleleGenome<float>::className() const;
+template <> int GA1DArrayAlleleGenome<float>::classID() const;
+
 int GARealGaussianMutator(GAGenome &, float);
+int GARealTypedGaussianMutator(GA1DArrayAlleleGenome<float> &, float);
 
-// in one (and only one) place in the code that uses the string genome, you 
-// should define INSTANTIATE_STRING_GENOME in order to force the specialization
-// for this genome.
-#if defined(INSTANTIATE_REAL_GENOME)
-#include <GARealGenome.C>
-#endif
+// The real genome knows the unchecked versions of the GAReal operators too.
+template <>
+GAGenome::Mutator
+GA1DArrayAlleleGenome<float>::uncheckedMutator(GAGenome::Mutator f) const;
+template <>
+GAGenome::SexualCrossover
+GA1DArrayAlleleGenome<float>::uncheckedCrossover(GAGenome::SexualCrossover f) const;
 
 inline void GARealUniformInitializer(GAGenome& g){
   GA1DArrayAlleleGenome<float>::UniformInitializer(g);
@@ -76,5 +94,18 @@ int GARealArithmeticCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d);
 int GARealBlendCrossover(const GAGenome& a, const GAGenome& b,
 				  GAGenome* c, GAGenome* d);
+int GARealTypedArithmeticCrossover(const GA1DArrayGenome<float> &,
+	const GA1DArrayGenome<float> &, GA1DArrayGenome<float> *,
+	GA1DArrayGenome<float> *);
+int GARealTypedBlendCrossover(const GA1DArrayGenome<float> &,
+	const GA1DArrayGenome<float> &, GA1DArrayGenome<float> *,
+	GA1DArrayGenome<float> *);
+
+// in one (and only one) place in the code that uses the string genome, you 
+// should define INSTANTIATE_STRING_GENOME in order to force the specialization
+// for this genome.
+#if defined(INSTANTIATE_REAL_GENOME)
+#include <GARealGenome.C>
+#endif
 
 #endif
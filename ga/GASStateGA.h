@@ -57,6 +57,7 @@ class GASteadyStateGA : public GAGeneticAlgorithm
 	}
 	void objectiveFunction(GAGenome::Evaluator f) override;
 	void objectiveData(const GAEvalData &v) override;
+	void recycle(const GAGenome &) override;
 
 	float pReplacement() const { return pRepl; }
 	float pReplacement(float p);
@@ -24,6 +24,9 @@ it does know how to update itself, but it must be told when.
 #include <gaconfig.h>
 #include <gaid.h>
 #include <gatypes.h>
+#include <GANeighborSearch.h>
+#include <GAThreadPool.h>
+#include <unordered_map>
 #include <vector>
 
 class GAPopulation;
@@ -32,6 +35,8 @@ constexpr float gaDefLinearScalingMultiplier = 1.2;
 constexpr float gaDefSigmaTruncationMultiplier = 2.0;
 constexpr float gaDefPowerScalingFactor = 1.0005;
 constexpr float gaDefSharingCutoff = 1.0;
+constexpr float gaDefClearingRadius = 0.1;
+constexpr int gaDefClearingCapacity = 1;
 
 /* ----------------------------------------------------------------------------
 Scaling
@@ -265,6 +270,28 @@ then it bases its min/max on the sort order of the population.
 	GA::MAXIMIZE - scale by dividing the raw scores
 	0            - minimize or maximize based upon the GA's settings
 
+  Finding the distances between all pairs of genomes takes n*n comparisons
+(and n*n floats), but only the genomes that are closer than sigma count.  If
+the genomes can be mapped to points, give the sharing an embedding:  a
+function that writes the coordinates of a genome into an array of dimension
+floats (the phenotype of a real or Bin2Dec genome, the bits of a bit string).
+The distance between two genomes is then the distance between their points
+(EUCLIDEAN, MANHATTAN or HAMMING, see GANeighborSearch.h), and the distance
+function is not used.  The bit string, Bin2Dec and array genomes have
+embeddings of their own (BitEmbedding, PhenotypeEmbedding and
+ElementEmbedding).  The bits with HAMMING give the same distances as the bit
+comparator, so if there is no embedding and no distance function, bit strings
+(and Bin2Dec genomes) of one length that use the bit comparator are done that
+way anyway.  The others give different distances from the default
+comparators, so you have to ask for them.  The neighbours of each genome come from a k-d tree (or
+from hashing blocks of bits for HAMMING), so a population in which each
+genome has a few neighbours takes about n log n time.  The fitness is the
+same as it would be with a distance function that returns those distances.
+  With nThreads bigger than 1 (or 0, one per hardware thread) the distances
+and the fitness are computed on that many threads, so the distance function
+(or the embedding) and the objective must be safe to call from several
+threads at once.  The default is 1.
+
 *** This should be called TriangularSharing rather than simply Sharing.
 ---------------------------------------------------------------------------- */
 #if USE_SHARING == 1
@@ -273,6 +300,8 @@ class GASharing : public GAScalingScheme
   public:
 	GADefineIdentity("GASharing", GAID::Sharing);
 
+	using Embedding = void (*)(const GAGenome &, float *);
+
 	explicit GASharing(GAGenome::Comparator func, float cut = gaDefSharingCutoff,
 			  float a = 1.0)
 	{
@@ -281,6 +310,10 @@ class GASharing : public GAScalingScheme
 		_sigma = cut;
 		_alpha = a;
 		_minmax = 0;
+		embed = nullptr;
+		edim = 0;
+		emetric = GANeighborSearch::EUCLIDEAN;
+		nthreads = 1;
 	}
 	explicit GASharing(float cut = gaDefSharingCutoff, float a = 1.0) :
 		df(nullptr)
@@ -289,6 +322,10 @@ class GASharing : public GAScalingScheme
 		_sigma = cut;
 		_alpha = a;
 		_minmax = 0;
+		embed = nullptr;
+		edim = 0;
+		emetric = GANeighborSearch::EUCLIDEAN;
+		nthreads = 1;
 	}
 	GASharing(const GASharing &arg) : GAScalingScheme(arg) 
 	{
@@ -320,6 +357,15 @@ class GASharing : public GAScalingScheme
 	int minimaxi(int i);
 	int minimaxi() const { return _minmax; }
 
+	void embedding(Embedding f, unsigned int dimension,
+				   GANeighborSearch::Metric m = GANeighborSearch::EUCLIDEAN);
+	Embedding embedding() const { return embed; }
+	unsigned int dimension() const { return edim; }
+	GANeighborSearch::Metric metric() const { return emetric; }
+
+	int nThreads(unsigned int n) { return nthreads = n; }
+	int nThreads() const { return nthreads; }
+
   protected:
 	GAGenome::Comparator df; // the user-defined distance function
 	unsigned int N; // how many do we have? (n of n-by-n)
@@ -327,6 +373,105 @@ class GASharing : public GAScalingScheme
 	float _sigma; // absolute cutoff from central point
 	float _alpha; // controls the curvature of sharing f
 	int _minmax; // should we minimize or maximize?
+	Embedding embed; // maps a genome to a point (optional)
+	unsigned int edim; // how many coordinates each point has
+	GANeighborSearch::Metric emetric; // the distance between points
+	unsigned int nthreads; // number of threads (0 is one per core)
+	std::vector<float> points; // the points of the genomes
+	GANeighborSearch index; // finds the genomes within sigma
+	GAThreadPool pool;
+
+	double share(float dist) const;
+};
+#endif
+
+/* ----------------------------------------------------------------------------
+Clearing
+
+  This scaling object does clearing as described by Petrowski (1996).  Rather
+than sharing the fitness of a niche among all of its members, clearing lets
+the best few of each niche keep their score and clears the rest.
+  The genomes are sorted once by score.  Going from the best to the worst, a
+genome joins the niche of the first (so the best) niche seed that is closer
+than radius to it.  If there is no such seed it becomes the seed of a new
+niche.  The first capacity members of a niche (the seed and the best capacity-1
+of the rest) keep their score as their fitness, the others get the worst score
+in the population.  Each genome is compared only with the seeds, so this takes
+n*niches comparisons instead of the n*n that sharing needs.
+  The distance is the comparator, if there is one, or the genome's compare
+method.  It should be 0 for identical genomes, just as for sharing.  The min/max
+is worked out the same way as for sharing.
+  After evaluate, niche tells you which niche a genome of the population is in
+(or -1 if it was not in the population), seed gives you the genome at the
+centre of a niche, and nicheSize gives you the number of genomes in it.  A
+selector (for restricted mating, say) can get at them through the scaling
+of the population it selects from:
+
+	GAClearing *c = DYN_CAST(GAClearing *, &pop.scaling());
+	if (c != nullptr && c->niche(mom) == c->niche(dad)) ...
+
+These refer to the genomes as they were when the population was last scaled,
+so they are out of date once any of the genomes has been replaced.  A copy of
+the scheme (the scaling of a copied population, say) has no niches until it
+is evaluated.
+---------------------------------------------------------------------------- */
+#if USE_CLEARING == 1
+class GAClearing : public GAScalingScheme
+{
+  public:
+	GADefineIdentity("GAClearing", GAID::Clearing);
+
+	explicit GAClearing(GAGenome::Comparator func,
+						float r = gaDefClearingRadius,
+						int kappa = gaDefClearingCapacity)
+		: df(func), _radius(r), _capacity(kappa), _minmax(0)
+	{
+	}
+	explicit GAClearing(float r = gaDefClearingRadius,
+						int kappa = gaDefClearingCapacity)
+		: df(nullptr), _radius(r), _capacity(kappa), _minmax(0)
+	{
+	}
+	GAClearing(const GAClearing &arg) : GAScalingScheme(arg) { copy(arg); }
+	GAClearing &operator=(const GAScalingScheme &arg)
+	{
+		copy(arg);
+		return (*this);
+	}
+	~GAClearing() override = default;
+	GAScalingScheme *clone() const override { return new GAClearing(*this); }
+	void copy(const GAScalingScheme &arg) override;
+	void evaluate(const GAPopulation &p) override;
+
+	GAGenome::Comparator distanceFunction(GAGenome::Comparator f)
+	{
+		return df = f;
+	}
+	GAGenome::Comparator distanceFunction() const { return df; }
+
+	float radius(float);
+	float radius() const { return _radius; }
+
+	int capacity(int);
+	int capacity() const { return _capacity; }
+
+	int minimaxi(int i);
+	int minimaxi() const { return _minmax; }
+
+	int nNiches() const { return STA_CAST(int, seeds.size()); }
+	int niche(const GAGenome &g) const;
+	const GAGenome &seed(int k) const { return *seeds[k]; }
+	int nicheSize(int k) const { return sizes[k]; }
+
+  protected:
+	GAGenome::Comparator df; // the user-defined distance function
+	float _radius; // genomes closer than this to a seed are in its niche
+	int _capacity; // how many of each niche keep their score
+	int _minmax; // should we minimize or maximize?
+	std::vector<int> order; // the population from best to worst
+	std::vector<const GAGenome *> seeds; // the seed of each niche
+	std::vector<int> sizes; // how many genomes are in each niche
+	std::unordered_map<const GAGenome *, int> member; // niche of each genome
 };
 #endif
 
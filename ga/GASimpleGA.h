@@ -66,6 +66,7 @@ class GASimpleGA : public GAGeneticAlgorithm
 	}
 	void objectiveFunction(GAGenome::Evaluator f) override;
 	void objectiveData(const GAEvalData &v) override;
+	void recycle(const GAGenome &) override;
 
   protected:
 	GAPopulation *oldPop; // current and old populations
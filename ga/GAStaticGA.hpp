@@ -0,0 +1,457 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GAStaticGA.hpp
+
+ DESCRIPTION:
+  Header file for the statically dispatched simple genetic algorithm.  The
+regular genetic algorithms call the objective function, the crossover, the
+mutator and the selector through function pointers (and most of the built-in
+operators do a DYN_CAST on every call).  That is fine when the objective is
+expensive, but for tight problems the call overhead dominates.
+  GAStaticGA is a generational genetic algorithm that works exactly like
+GASimpleGA, but the genome type, the objective, the crossover, the mutator and
+the selector are template arguments, so every call in the inner loop is
+resolved (and usually inlined) at compile time.  The policies are classes with
+static member functions:
+
+	Objective::evaluate(Genome &)                              -> float
+	Crossover::cross(const Genome &, const Genome &, Genome *, Genome *)
+	                                                             -> int
+	Mutator::mutate(Genome &, float pmut)                       -> int
+	Selector::select(GAPopulation &)                            -> GAGenome &
+
+  The crossover and the mutator return the number of crossovers/mutations, just
+like the library operators.  Either child pointer may be nil.
+  The engine is a GASimpleGA, so the populations, the statistics, the
+parameters, the terminators and elitism all work as usual.  The policies are
+also installed in the genomes (as evaluator, crossover and mutator), so code
+that calls the genome members directly sees the same operators.
+  Use the GAStaticObjectiveFunction, GAStaticSexualCrossover and
+GAStaticMutatorFunction adapters to plug existing operators into the engine.
+The function is a template argument, so the compiler can inline it too.  The
+GAStaticPopulationSelector uses the selection scheme of the population, so
+scaling and all of the library selectors still work.
+---------------------------------------------------------------------------- */
+#ifndef _ga_staticga_h_
+#define _ga_staticga_h_
+
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+/* ----------------------------------------------------------------------------
+Adapters for the regular operator functions
+---------------------------------------------------------------------------- */
+template <float (*f)(GAGenome &)> class GAStaticObjectiveFunction
+{
+  public:
+	static float evaluate(GAGenome &g) { return (*f)(g); }
+};
+
+template <int (*f)(const GAGenome &, const GAGenome &, GAGenome *, GAGenome *)>
+class GAStaticSexualCrossover
+{
+  public:
+	static int cross(const GAGenome &p1, const GAGenome &p2, GAGenome *c1,
+					 GAGenome *c2)
+	{
+		return (*f)(p1, p2, c1, c2);
+	}
+};
+
+template <int (*f)(GAGenome &, float)> class GAStaticMutatorFunction
+{
+  public:
+	static int mutate(GAGenome &g, float pmut) { return (*f)(g, pmut); }
+};
+
+/* ----------------------------------------------------------------------------
+Crossovers
+
+  These work with the binary strings and the 1D arrays (any genome that has
+length, resize, gene(i)/gene(i,value) and a ranged copy).  The parents must have the
+same length.
+---------------------------------------------------------------------------- */
+template <class G> class GAStaticUniformCrossover
+{
+  public:
+	// For each gene we flip a coin to see which parent it comes from.  The
+	// second child gets the gene from the other parent.
+	static int cross(const G &mom, const G &dad, G *c1, G *c2)
+	{
+		if (GA_CHECK(mom.length() != dad.length()))
+		{
+			GAErr(GA_LOC, mom.className(), "uniform cross",
+				  GAError::SameLengthReqd);
+			return 0;
+		}
+
+		int n = mom.length();
+		if (c1 && c2)
+		{
+			if (c1->length() != n)
+				c1->resize(n);
+			if (c2->length() != n)
+				c2->resize(n);
+			for (int i = n - 1; i >= 0; i--)
+			{
+				if (GARandomBit())
+				{
+					c1->gene(i, mom.gene(i));
+					c2->gene(i, dad.gene(i));
+				}
+				else
+				{
+					c1->gene(i, dad.gene(i));
+					c2->gene(i, mom.gene(i));
+				}
+			}
+			return 2;
+		}
+
+		G *c = (c1 ? c1 : c2);
+		if (c == nullptr)
+			return 0;
+		if (c->length() != n)
+			c->resize(n);
+		for (int i = n - 1; i >= 0; i--)
+			c->gene(i, (GARandomBit() ? mom.gene(i) : dad.gene(i)));
+		return 1;
+	}
+};
+
+template <class G> class GAStaticOnePointCrossover
+{
+  public:
+	// Pick a single cut point.  The first child gets the head of the mother
+	// and the tail of the father, the second child gets the rest.  The pieces
+	// are copied with the ranged copy of the genome.
+	static int cross(const G &mom, const G &dad, G *c1, G *c2)
+	{
+		if (GA_CHECK(mom.length() != dad.length()))
+		{
+			GAErr(GA_LOC, mom.className(), "one-point cross",
+				  GAError::SameLengthReqd);
+			return 0;
+		}
+
+		int n = mom.length();
+		int cut = GARandomInt(0, n);
+		int nc = 0;
+		if (c1)
+		{
+			if (c1->length() != n)
+				c1->resize(n);
+			c1->copy(mom, 0, 0, cut);
+			c1->copy(dad, cut, cut, n - cut);
+			nc++;
+		}
+		if (c2)
+		{
+			if (c2->length() != n)
+				c2->resize(n);
+			c2->copy(dad, 0, 0, cut);
+			c2->copy(mom, cut, cut, n - cut);
+			nc++;
+		}
+		return nc;
+	}
+};
+
+/* ----------------------------------------------------------------------------
+Mutators
+---------------------------------------------------------------------------- */
+// Flip bits.  This is the same algorithm as the binary string FlipMutator.
+template <class G> class GAStaticFlipMutator
+{
+  public:
+	static int mutate(G &child, float pmut)
+	{
+		if (pmut <= 0.0)
+			return 0;
+
+		float nMut = pmut * STA_CAST(float, child.length());
+		if (nMut < 1.0)
+		{ // we have to do a flip test on each bit
+			nMut = 0;
+			for (int i = child.length() - 1; i >= 0; i--)
+			{
+				if (GAFlipCoin(pmut))
+				{
+					child.gene(i, ((child.gene(i) == 0) ? 1 : 0));
+					nMut++;
+				}
+			}
+		}
+		else
+		{ // only flip the number of bits we need to flip
+			for (int n = 0; n < nMut; n++)
+			{
+				int i = GARandomInt(0, child.length() - 1);
+				child.gene(i, ((child.gene(i) == 0) ? 1 : 0));
+			}
+		}
+		return STA_CAST(int, nMut);
+	}
+};
+
+// Swap elements.  This is the same algorithm as the array SwapMutator, so it
+// keeps permutations intact.
+template <class G> class GAStaticSwapMutator
+{
+  public:
+	static int mutate(G &child, float pmut)
+	{
+		if (pmut <= 0.0)
+			return 0;
+
+		float nMut = pmut * STA_CAST(float, child.length());
+		int length = child.length() - 1;
+		if (nMut < 1.0)
+		{
+			nMut = 0;
+			for (int i = length; i >= 0; i--)
+			{
+				if (GAFlipCoin(pmut))
+				{
+					child.swap(i, GARandomInt(0, length));
+					nMut++;
+				}
+			}
+		}
+		else
+		{
+			for (int n = 0; n < nMut; n++)
+				child.swap(GARandomInt(0, length), GARandomInt(0, length));
+		}
+		return STA_CAST(int, nMut);
+	}
+};
+
+/* ----------------------------------------------------------------------------
+Selectors
+---------------------------------------------------------------------------- */
+// Use the selection scheme of the population (and therefore its scaling).
+class GAStaticPopulationSelector
+{
+  public:
+	static GAGenome &select(GAPopulation &pop) { return pop.select(); }
+};
+
+// Pick an individual at random.
+class GAStaticUniformSelector
+{
+  public:
+	static GAGenome &select(GAPopulation &pop)
+	{
+		return pop.individual(GARandomInt(0, pop.size() - 1));
+	}
+};
+
+// Binary tournament on the raw scores.  This does not need the scaled
+// fitness, so the population never has to be scaled or sorted.
+class GAStaticTournamentSelector
+{
+  public:
+	static GAGenome &select(GAPopulation &pop)
+	{
+		GAGenome &a = pop.individual(GARandomInt(0, pop.size() - 1));
+		GAGenome &b = pop.individual(GARandomInt(0, pop.size() - 1));
+		if (pop.order() == GAPopulation::HIGH_IS_BEST)
+			return (a.score() >= b.score()) ? a : b;
+		return (a.score() <= b.score()) ? a : b;
+	}
+};
+
+/* ----------------------------------------------------------------------------
+GAStaticGA
+---------------------------------------------------------------------------- */
+template <class GenomeType, class Objective, class Crossover, class Mutator,
+		  class Selector = GAStaticPopulationSelector>
+class GAStaticGA : public GASimpleGA
+{
+  public:
+	GADefineIdentity("GAStaticGA", GAID::StaticGA);
+
+	// These forward to the policies.  They are installed in the genomes so
+	// that the genome members use the same operators as the engine.
+	static float Evaluator(GAGenome &g)
+	{
+		return Objective::evaluate(STA_CAST(GenomeType &, g));
+	}
+	static int Cross(const GAGenome &p1, const GAGenome &p2, GAGenome *c1,
+					 GAGenome *c2)
+	{
+		return Crossover::cross(STA_CAST(const GenomeType &, p1),
+								STA_CAST(const GenomeType &, p2),
+								STA_CAST(GenomeType *, c1), STA_CAST(GenomeType *, c2));
+	}
+	static int Mutate(GAGenome &g, float pmut)
+	{
+		return Mutator::mutate(STA_CAST(GenomeType &, g), pmut);
+	}
+
+  public:
+	explicit GAStaticGA(const GenomeType &g) : GASimpleGA(g) { bind(); }
+	GAStaticGA(const GAStaticGA &ga) : GASimpleGA(ga) {}
+	GAStaticGA &operator=(const GAStaticGA &ga)
+	{
+		if (&ga != this)
+			copy(ga);
+		return *this;
+	}
+	~GAStaticGA() override = default;
+
+	// Same as GASimpleGA.  The initial population goes through the population
+	// evaluator (and therefore the Evaluator above) so that the genomes count
+	// their evaluations for the statistics.
+	void initialize(unsigned int seed = 0) override
+	{
+		GARandomSeed(seed);
+
+		pop->initialize();
+		pop->evaluate(true);
+
+		stats.reset(*pop);
+	}
+
+	// Same generation as GASimpleGA::step (it uses the random numbers in the
+	// same order, so a GAStaticGA with the population selector and the
+	// adapted operators produces the same populations as GASimpleGA).  The
+	// children are scored as soon as they are made, so the population
+	// evaluator has nothing left to do.
+	void step() override
+	{
+		GAPhaseTimer timer(&stats, GAStatistics::Phase::Other);
+		int mut, c1, c2;
+		GenomeType *mom, *dad;
+
+		GAPopulation *tmppop = oldPop;
+		oldPop = pop;
+		pop = tmppop;
+
+		int i;
+		for (i = 0; i < pop->size() - 1; i += 2)
+		{
+			stats.startPhase(GAStatistics::Phase::Selection);
+			mom = &STA_CAST(GenomeType &, Selector::select(*oldPop));
+			dad = &STA_CAST(GenomeType &, Selector::select(*oldPop));
+			stats.stopPhase();
+			stats.numsel += 2;
+
+			GenomeType &sis = STA_CAST(GenomeType &, pop->individual(i));
+			GenomeType &bro = STA_CAST(GenomeType &, pop->individual(i + 1));
+
+			c1 = c2 = 0;
+			stats.startPhase(GAStatistics::Phase::Crossover);
+			if (GAFlipCoin(pCrossover()))
+			{
+				stats.numcro += Crossover::cross(*mom, *dad, &sis, &bro);
+				c1 = c2 = 1;
+			}
+			else
+			{
+				sis.copy(*mom);
+				bro.copy(*dad);
+			}
+			stats.stopPhase();
+			stats.startPhase(GAStatistics::Phase::Mutation);
+			stats.nummut += (mut = Mutator::mutate(sis, pMutation()));
+			if (mut > 0)
+				c1 = 1;
+			stats.nummut += (mut = Mutator::mutate(bro, pMutation()));
+			if (mut > 0)
+				c2 = 1;
+			stats.stopPhase();
+
+			stats.numeval += c1 + c2;
+		}
+
+		if (pop->size() % 2 != 0)
+		{ // do the remaining population member
+			stats.startPhase(GAStatistics::Phase::Selection);
+			mom = &STA_CAST(GenomeType &, Selector::select(*oldPop));
+			dad = &STA_CAST(GenomeType &, Selector::select(*oldPop));
+			stats.stopPhase();
+			stats.numsel += 2;
+
+			GenomeType &sis = STA_CAST(GenomeType &, pop->individual(i));
+
+			c1 = 0;
+			stats.startPhase(GAStatistics::Phase::Crossover);
+			if (GAFlipCoin(pCrossover()))
+			{
+				stats.numcro += Crossover::cross(*mom, *dad, &sis, nullptr);
+				c1 = 1;
+			}
+			else
+			{
+				sis.copy((GARandomBit() != 0) ? *mom : *dad);
+			}
+			stats.stopPhase();
+			stats.startPhase(GAStatistics::Phase::Mutation);
+			stats.nummut += (mut = Mutator::mutate(sis, pMutation()));
+			if (mut > 0)
+				c1 = 1;
+			stats.stopPhase();
+
+			stats.numeval += c1;
+		}
+
+		stats.numrep += pop->size();
+		evaluate(*pop);
+		pop->evaluate(true);
+
+		stats.startPhase(GAStatistics::Phase::Replacement);
+		if (el)
+		{
+			float oldbest = oldPop->best().score();
+			float newbest = pop->best().score();
+			if ((minimaxi() == GAGeneticAlgorithm::MAXIMIZE && oldbest > newbest) ||
+				(minimaxi() == GAGeneticAlgorithm::MINIMIZE && oldbest < newbest))
+			{
+				oldPop->replace(
+					pop->replace(&(oldPop->best()), GAPopulation::WORST),
+					GAPopulation::BEST);
+			}
+		}
+		stats.stopPhase();
+
+		stats.update(*pop);
+	}
+
+	GAStaticGA &operator++()
+	{
+		step();
+		return *this;
+	}
+
+  protected:
+	// Install the policies in every genome of both populations.  Genomes that
+	// are added later are clones of these, so they get the policies as well.
+	void bind()
+	{
+		objectiveFunction(Evaluator);
+		crossover(Cross);
+		for (int i = 0; i < pop->size(); i++)
+		{
+			pop->individual(i).mutator(Mutate);
+			pop->individual(i).crossover(Cross);
+			oldPop->individual(i).mutator(Mutate);
+			oldPop->individual(i).crossover(Cross);
+		}
+	}
+
+	// Score every genome that needs it with a direct call to the objective.
+	static void evaluate(GAPopulation &p)
+	{
+		GAPhaseTimer timer(GAStatistics::Phase::Evaluation);
+		for (int i = 0; i < p.size(); i++)
+		{
+			GAGenome &g = p.individual(i);
+			if (!g.isEvaluated())
+				g.score(Objective::evaluate(STA_CAST(GenomeType &, g)));
+		}
+	}
+};
+
+#endif
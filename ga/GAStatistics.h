@@ -16,6 +16,9 @@
 #include <gaconfig.h>
 #include <gatypes.h>
 
+#include <chrono>
+#include <vector>
+
 // Default settings and their names.
 extern int gaDefNumBestGenomes;
 extern int gaDefScoreFrequency1;
@@ -44,6 +47,26 @@ class GAStatistics
 		AllScores = 0xff
 	};
 
+	// The phases of a generation for which we keep timing information.  The
+	// time spent in a phase does not include the time spent in any phase that
+	// is started from within it, so a sort that triggers evaluations is
+	// charged only for the sorting.  Anything else a GA does in its step is
+	// charged to Other.
+	enum class Phase
+	{
+		Selection = 0,
+		Crossover,
+		Mutation,
+		Evaluation,
+		Replacement,
+		Scaling,
+		Sorting,
+		Diversity,
+		Statistics,
+		Other
+	};
+	static constexpr int NumPhases = 10;
+
 	GAStatistics();
 	GAStatistics(const GAStatistics &);
 	GAStatistics &operator=(const GAStatistics &orig)
@@ -87,6 +110,20 @@ class GAStatistics
 	bool recordDiversity() const { return dodiv; }
 	void flushScores();
 
+	bool recordTiming(bool flag);
+	bool recordTiming() const { return dotime; }
+	double phaseTime(Phase p) const
+	{
+		return secs(genTime[static_cast<int>(p)]);
+	}
+	double totalPhaseTime(Phase p) const
+	{
+		return secs(totTime[static_cast<int>(p)]);
+	}
+	double generationTime() const;
+	double totalTime() const;
+	static const char *phaseName(Phase p);
+
 	void update(const GAPopulation &pop);
 	void reset(const GAPopulation &pop);
 	const GAPopulation &bestPopulation() const { return *boa; }
@@ -96,6 +133,8 @@ class GAStatistics
 	int scores(std::ostream &os, int which = NoScores);
 	int write(const std::string &filename) const;
 	int write(std::ostream &os) const;
+	int timings(const std::string &filename) const;
+	int timings(std::ostream &os) const;
 
 	// These should be protected (accessible only to the GA class) but for now
 	// they are publicly accessible.  Do not try to set these unless you know
@@ -107,7 +146,39 @@ class GAStatistics
 	unsigned long int numeval; // number of individual evaluations since reset
 	unsigned long int numpeval; // number of population evals since reset
 
+	// The GAs and populations use these (via GAPhaseTimer) to mark the start
+	// and end of each phase.  They do nothing unless timing is enabled.
+	void startPhase(Phase p)
+	{
+		if (dotime)
+		{
+			pushPhase(p);
+		}
+	}
+	void stopPhase()
+	{
+		if (!phases.empty())
+		{
+			popPhase();
+		}
+	}
+	// Charge time that was measured somewhere else (on other threads, say) to
+	// a phase of the generation in progress.  It is taken out of the phase
+	// that is running, so the generation takes no longer than it did.
+	void chargePhase(Phase p, double seconds);
+	// The statistics that phase timers on this thread charge when they are not
+	// given any.  Setting it returns the one that was active before.
+	static GAStatistics *timer();
+	static GAStatistics *timer(GAStatistics *s);
+
   protected:
+	using Clock = std::chrono::steady_clock;
+
+	static double secs(Clock::duration d)
+	{
+		return std::chrono::duration<double>(d).count();
+	}
+
 	unsigned int curgen; // current generation number
 	unsigned int scoreFreq; // how often (in generations) to record scores
 	bool dodiv; // should we record diversity?
@@ -154,11 +225,30 @@ class GAStatistics
 	// keep a copy of the best genomes
 	GAPopulation *boa; 
 
+	// should we record the time spent in each phase?
+	bool dotime;
+	// time spent in each phase during the generation in progress
+	Clock::duration curTime[NumPhases];
+	// time spent in each phase during the last complete generation
+	Clock::duration genTime[NumPhases];
+	// time spent in each phase since reset
+	Clock::duration totTime[NumPhases];
+	// phases that are currently running, innermost last
+	std::vector<Phase> phases;
+	// when the innermost running phase was (re)started
+	Clock::time_point phaseStart;
+	// the timer that was active before this one took over
+	GAStatistics *prevTimer;
+
 	void setConvergence(float);
 	void setScore(const GAPopulation &);
 	void updateBestIndividual(const GAPopulation &, bool flag = false);
 	void writeScores();
 	void resizeScores(unsigned int);
+	void pushPhase(Phase);
+	void popPhase();
+	void resetTiming();
+	void rollTiming();
 
 	friend class GA;
 };
@@ -231,6 +321,42 @@ inline float GAStatistics::current(int w) const
 	return val;
 }
 
+/* ----------------------------------------------------------------------------
+Phase timer
+  Create one of these at the top of a block to charge the time spent in the
+block to a phase.  If no statistics object is given, the time is charged to
+the statistics of whichever GA is currently stepping (if any).  When timing is
+not enabled the timer costs no more than a pointer test.
+---------------------------------------------------------------------------- */
+class GAPhaseTimer
+{
+  public:
+	GAPhaseTimer(GAStatistics *s, GAStatistics::Phase p)
+		: stats((s != nullptr && s->recordTiming()) ? s : nullptr)
+	{
+		if (stats != nullptr)
+		{
+			stats->startPhase(p);
+		}
+	}
+	explicit GAPhaseTimer(GAStatistics::Phase p)
+		: GAPhaseTimer(GAStatistics::timer(), p)
+	{
+	}
+	GAPhaseTimer(const GAPhaseTimer &) = delete;
+	GAPhaseTimer &operator=(const GAPhaseTimer &) = delete;
+	~GAPhaseTimer()
+	{
+		if (stats != nullptr)
+		{
+			stats->stopPhase();
+		}
+	}
+
+  private:
+	GAStatistics *stats;
+};
+
 inline std::ostream &operator<<(std::ostream &os, const GAStatistics &s)
 {
 	s.write(os);
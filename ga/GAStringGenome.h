@@ -19,6 +19,20 @@ using GAStringAlleleSetArray = GAAlleleSetArray<char>;
 
 using GAStringGenome = GA1DArrayAlleleGenome<char>;
 
+// The string genome has constructors of its own (for its default operators),
+// so code that uses it must not get the ones of the template.
+template <>
+GA1DArrayAlleleGenome<char>::GA1DArrayAlleleGenome(unsigned int,
+	const GAAlleleSet<char> &, GAGenome::Evaluator, void *);
+template <>
+GA1DArrayAlleleGenome<char>::GA1DArrayAlleleGenome(
+	const GAAlleleSetArray<char> &, GAGenome::Evaluator, void *);
+template <> GA1DArrayAlleleGenome<char>::~GA1DArrayAlleleGenome();
+template <> int GA1DArrayAlleleGenome<char>::read(std::istream &);
+template <> int GA1DArrayAlleleGenome<char>::write(std::ostream &) const;
+template <> const char *GA1DArrayAlleleGenome<char>::className() const;
+template <> int GA1DArrayAlleleGenome<char>::classID() const;
+
 // in one (and only one) place in the code that uses the string genome, you
 // should define INSTANTIATE_STRING_GENOME in order to force the specialization
 // for this genome.
@@ -0,0 +1,48 @@
+// $Header$
+/* ----------------------------------------------------------------------------
+  GAThreadPool.h
+
+ DESCRIPTION:
+  The way the GAs that do the work of a generation in parallel hand that work
+out.  The pool has no threads of its own; the jobs go to the executor that the
+whole library shares (see GAExecutor.h), so a pool can be used from inside a
+job of another pool (or of the same one) without starting more threads than
+there are cores, and without deadlock.
+
+size
+  The most threads that work on the jobs at once, counting the thread that
+  calls run.  0 (the default) means as many as the executor has.
+
+run
+  Call f(job, worker) for each job from 0 to njobs-1 and return when they are
+  all done.  The calling thread works on the jobs too (as worker 0), the
+  others are numbered from 1 to size()-1, and no two threads are the same
+  worker at once.  The jobs are handed out one at a time in order, so a slow
+  job does not hold up the others, but there is no telling which worker gets
+  which job.  When the executor is inlined, the calling thread does all of
+  the jobs in order.
+---------------------------------------------------------------------------- */
+#ifndef _ga_threadpool_h_
+#define _ga_threadpool_h_
+
+#include <functional>
+
+class GAThreadPool
+{
+  public:
+	using Job = std::function<void(int job, int worker)>;
+
+	explicit GAThreadPool(unsigned int nthreads = 0) : nthreads(nthreads) {}
+	GAThreadPool(const GAThreadPool &) = delete;
+	GAThreadPool &operator=(const GAThreadPool &) = delete;
+
+	unsigned int size() const;
+	void size(unsigned int n) { nthreads = n; }
+
+	void run(int njobs, const Job &f);
+
+  protected:
+	unsigned int nthreads; // 0 is as many as the executor has
+};
+
+#endif
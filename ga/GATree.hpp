@@ -32,9 +32,8 @@ careful so that you don't end up with an iterator dangling with a pointer to
 a part of a tree that no longer exists (I would need some kind of reference
 counting and/or message passing to take care of this at a lower level, and I'm
 not ready to implement that at this point).
-  For now we allocate nodes on the fly.  Eventually I would like to do some
-better memory management (arrays perhaps?) so we don't have to do so much
-alloc and dealloc and recursion.
+  The nodes come from the node pool (see GANodePool.h), so allocating and
+freeing them is cheap.  There is still plenty of recursion, though.
   We depend on the template-ized GATreeIter routine, thus the declaration.
 
 copy
@@ -95,7 +94,8 @@ Recursive routines for the Tree objects
 ---------------------------------------------------------------------------- */
 // Recursively copy a node, including all of its siblings.  This routine copies
 // a row, then it calls itself to copy the next generation if it finds a next
-// generation in the next node.
+// generation in the next node.  Every node in a GATree<T> is a GANode<T>, so
+// we do not need to check the casts.
 template <class T> GANode<T> *_GATreeCopy(GANode<T> *node, GANode<T> *parent)
 {
 	if (!node)
@@ -103,20 +103,20 @@ template <class T> GANode<T> *_GATreeCopy(GANode<T> *node, GANode<T> *parent)
 
 	auto *newnode = new GANode<T>(node->contents);
 	newnode->parent = parent;
-	newnode->child = _GATreeCopy(DYN_CAST(GANode<T> *, node->child), newnode);
+	newnode->child = _GATreeCopy(STA_CAST(GANode<T> *, node->child), newnode);
 
 	GANode<T> *lasttmp = newnode, *newtmp = nullptr;
-	GANode<T> *tmp = DYN_CAST(GANode<T> *, node->next);
+	GANode<T> *tmp = STA_CAST(GANode<T> *, node->next);
 	while (tmp && tmp != node)
 	{
 		newtmp = new GANode<T>(tmp->contents);
 		newtmp->parent = parent;
-		newtmp->child = _GATreeCopy(DYN_CAST(GANode<T> *, tmp->child), newtmp);
+		newtmp->child = _GATreeCopy(STA_CAST(GANode<T> *, tmp->child), newtmp);
 		newtmp->prev = lasttmp;
 		lasttmp->next = newtmp;
 
 		lasttmp = newtmp;
-		tmp = DYN_CAST(GANode<T> *, tmp->next);
+		tmp = STA_CAST(GANode<T> *, tmp->next);
 	}
 
 	if (newtmp)
@@ -143,7 +143,7 @@ template <class T> void _GATreeDestroy(GANode<T> *node)
 
 	if (node->parent)
 		node->parent->child = nullptr;
-	_GATreeDestroy(DYN_CAST(GANode<T> *, node->child));
+	_GATreeDestroy(STA_CAST(GANode<T> *, node->child));
 
 	GANodeBASE *tmp;
 	while (node->next && node->next != node)
@@ -151,7 +151,7 @@ template <class T> void _GATreeDestroy(GANode<T> *node)
 		tmp = node->next;
 		node->next = tmp->next;
 		tmp->next->prev = node;
-		_GATreeDestroy(DYN_CAST(GANode<T> *, tmp->child));
+		_GATreeDestroy(STA_CAST(GANode<T> *, tmp->child));
 		delete tmp;
 	}
 	delete node;
@@ -164,7 +164,7 @@ template <class T> class GATree : public GATreeBASE
   public:
 	GATree() : GATreeBASE() { iter(*this); }
 	explicit GATree(const T &t) : GATreeBASE(new GANode<T>(t)), iter(*this) {}
-	GATree(const GATree<T> &orig)
+	GATree(const GATree<T> &orig) : GATreeBASE()
 	{
 		iter(*this);
 		copy(orig);
@@ -181,7 +181,7 @@ template <class T> class GATree : public GATreeBASE
 	// doesn't get messed up.
 	~GATree()
 	{
-		_GATreeDestroy(DYN_CAST(GANode<T> *, rt));
+		_GATreeDestroy(STA_CAST(GANode<T> *, rt));
 		iter.node = nullptr;
 	}
 
@@ -198,17 +198,16 @@ template <class T> class GATree : public GATreeBASE
 	{
 		auto *t = new GATree<T>;
 		GANode<T> *node;
-		unsigned int w = 0;
 		if (i == 0)
-			node = DYN_CAST(GANode<T> *, rt);
+			node = STA_CAST(GANode<T> *, rt);
 		else
-			node = DYN_CAST(GANode<T> *, _GATreeTraverse(i, w, rt));
+			node = STA_CAST(GANode<T> *, GATreeBASE::node(i));
 		if (!node)
 			return t;
 
 		auto *newnode = new GANode<T>(node->contents);
 		newnode->child =
-			_GATreeCopy(DYN_CAST(GANode<T> *, node->child), newnode);
+			_GATreeCopy(STA_CAST(GANode<T> *, node->child), newnode);
 		if (newnode->child)
 			newnode->child->parent = newnode;
 
@@ -223,13 +222,14 @@ template <class T> class GATree : public GATreeBASE
 	// tree then we copy the new one.  No caching, no nothing.  Oh well.  The
 	// iterator is set to the root node - it should be set to the corresponding
 	// node, but I won't do that for now.  THIS IS A BUG!
+	//   The list of nodes refers to the nodes of the original, so we have to
+	// count the new tree again the next time somebody asks.
 	void copy(const GATree<T> &orig)
 	{
-		_GATreeDestroy(DYN_CAST(GANode<T> *, rt));
-		rt = _GATreeCopy(DYN_CAST(GANode<T> *, orig.rt), (GANode<T> *)nullptr);
+		_GATreeDestroy(STA_CAST(GANode<T> *, rt));
+		rt = _GATreeCopy(STA_CAST(GANode<T> *, orig.rt), (GANode<T> *)nullptr);
 		iter.node = rt;
-		sz = orig.sz;
-		csz = orig.csz;
+		csz = 1;
 		dpth = orig.dpth;
 		cdpth = orig.cdpth;
 	}
@@ -337,22 +337,35 @@ template <class T> class GATree : public GATreeBASE
 	//   the
 	// depth of the tree.  We leave the iterator where it was pointing before
 	// the swap.
+	//   The list of nodes is patched up rather than counted again.
 	int swaptree(unsigned int a, unsigned int b)
 	{
-		unsigned int aw = 0, bw = 0;
-		GANodeBASE *anode = _GATreeTraverse(a, aw, rt);
-		GANodeBASE *bnode = _GATreeTraverse(b, bw, rt);
-		return GATreeBASE::swaptree(anode, bnode);
+		GANodeBASE *anode = GATreeBASE::node(a);
+		GANodeBASE *bnode = GATreeBASE::node(b);
+		if (GATreeBASE::swaptree(anode, bnode) == GATreeBASE::ERR)
+			return GATreeBASE::ERR;
+		if (anode && bnode)
+			GATreeBASE::reindex(a, b);
+		return GATreeBASE::NO_ERR;
 	}
 
 	// Swap two nodes in a tree, leave their subtrees intact.  This routine does
-	// not affect the iterator or the size or depth of the tree.
+	// not affect the iterator or the size or depth of the tree.  The shape of
+	// the tree does not change, so node a is now at index b and vice versa and
+	// we can fix up the list of nodes rather than counting again.
 	int swap(unsigned int a, unsigned int b)
 	{
-		unsigned int aw = 0, bw = 0;
-		GANodeBASE *anode = _GATreeTraverse(a, aw, rt);
-		GANodeBASE *bnode = _GATreeTraverse(b, bw, rt);
-		return GATreeBASE::swapnode(anode, bnode);
+		GANodeBASE *anode = GATreeBASE::node(a);
+		GANodeBASE *bnode = GATreeBASE::node(b);
+		if (GATreeBASE::swapnode(anode, bnode) == GATreeBASE::ERR)
+			return GATreeBASE::ERR;
+		if (anode && bnode)
+		{
+			nodes[a] = bnode;
+			nodes[b] = anode;
+			csz = 0;
+		}
+		return GATreeBASE::NO_ERR;
 	}
 
 	// This remove method returns a tree with the removed node as its root.  The
@@ -404,6 +417,7 @@ template <class T> class GATree : public GATreeBASE
 		}
 		iter.node = (t->rt ? t->rt : iter.node);
 		t->rt = nullptr;
+		t->csz = 1;
 		t->iter.node = nullptr;
 		return GATreeBASE::NO_ERR;
 	}
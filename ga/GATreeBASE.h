@@ -12,6 +12,8 @@
 
 #include <GANode.h>
 
+#include <vector>
+
 /* ----------------------------------------------------------------------------
  GATreeBASE
 -------------------------------------------------------------------------------
@@ -84,6 +86,13 @@ size
   change the contents of the tree using any method other than those in this
   object (which you could do, by the way) then you risk screwing up the count.
 
+node
+  Return the node with the specified index (depth-first, the root is node 0)
+  or NULL if there is no such node.  When we count the nodes we also keep a
+  list of them in depth-first order, so this is a lookup rather than a
+  traversal unless the tree has changed since the last count.  Same caveats as
+  for size.
+
 depth
   How many levels (generations) are there in the tree?
 ---------------------------------------------------------------------------- */
@@ -123,12 +132,19 @@ class GATreeBASE
 	int swapnode(GANodeBASE *a, GANodeBASE *b);
 	int size() const;
 	int depth() const;
+	GANodeBASE *node(unsigned int i) const
+	{
+		return (i < (unsigned int)size() ? nodes[i] : nullptr);
+	}
 	int ancestral(unsigned int i, unsigned int j) const;
 
   protected:
+	void reindex(unsigned int a, unsigned int b);
+
 	int sz, dpth; // number of nodes, number of levels in tree
 	short csz, cdpth; // have the contents changed since last update?
 	GANodeBASE *rt; // the root node of the tree
+	std::vector<GANodeBASE *> nodes; // depth-first order, valid if csz is 0
 
   private:
 	GATreeBASE(const GATreeBASE &) {} // we don't allow copying
@@ -142,6 +142,43 @@ not need to instantiate one to use that method.
   In every case you MUST define an objective function and you MUST instantiate
 one copy of the genome type you want to use.
 
+-------------------------------------------------------------------------------
+Threads
+
+  You can run as many GAs at once as you like, each on its own thread.  GAs
+that were made separately (or copied from one another) share nothing that
+changes:  the random number generator, the last error and the timers are kept
+per thread, the node pools of the list and tree genomes keep a cache per
+thread, and the reference-counted cores of the allele sets and phenotypes are
+counted atomically.  Here is what you have to look after yourself:
+
+  - One GA, population or genome is used by one thread at a time.  The const
+    members of the population (statistics, sorting, scaling, diversity) bring
+    their caches up to date as they go, so they are not safe to call from two
+    threads at once either.
+  - Each thread seeds its own generator with GARandomSeed or GAResetRNG.  If
+    you seed with 0, every thread gets a different seed.
+  - Set the gaDef* defaults before you start any threads.
+  - The default RAN2 generator (and the other Numerical Recipes generators)
+    keep their state per thread.  RAND, RANDOM and RAND48 use the state of the
+    C library, which is shared.
+  - Objective functions and user data are yours.  If two GAs share them, they
+    must be safe to use from two threads.
+  - Give each GA its own score file if it flushes its scores.
+
+  GABatch does all of this for you if what you want is many small runs:  it
+hands them out to a pool of threads, seeds each one and keeps the GAs of the
+threads for the runs that come after.
+
+  Some of the operators run on several threads by themselves (GASharing, the
+deterministic crowding GA, the asynchronous GA, GABatch).  They all share the
+threads of one executor (GAExecutor), so they can be used inside one another
+without starting more threads than there are cores.  Set its size, pin its
+threads to cores, or inline it to have everything done in order on the
+calling thread.  They call the objective or distance functions from several
+threads, so those functions must be safe to use from several threads when you
+use these.
+
 ---------------------------------------------------------------------------- */
 #ifndef _ga_ga_h_
 #define _ga_ga_h_
@@ -154,9 +191,13 @@ one copy of the genome type you want to use.
 #include <GASimpleGA.h>
 #include <GASStateGA.h>
 #include <GAIncGA.h>
+#include <GAAsyncGA.h>
 #include <GADemeGA.h>
 #include <GADCrowdingGA.h>
 
+// This runs many small GAs at once.
+#include <GABatch.h>
+
 // Here we include the headers for all of the various genome types.
 #include <GA1DBinStrGenome.h>
 #include <GA2DBinStrGenome.h>
@@ -167,6 +208,8 @@ one copy of the genome type you want to use.
 #include <GA2DArrayGenome.hpp>
 #include <GA3DArrayGenome.h>
 #include <GAListGenome.hpp>
+#include <GAArrayListGenome.hpp>
 #include <GATreeGenome.hpp>
+#include <GAFlatTreeGenome.hpp>
 
 #endif
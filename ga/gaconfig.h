@@ -75,6 +75,16 @@ incorporate it into the code base.
   GALIB_BITS_IN_WORD  How many bits are in a word?  For many systems, a word is
 					  a char and is 8 bits long.
 
+  GALIB_USE_NODE_POOL Allocate the nodes of the lists and trees from a pool
+					  (see GANodePool.h) instead of one at a time with new and
+					  delete.  This is on by default; define
+					  GALIB_NO_NODE_POOL to turn it off.
+
+  GALIB_NO_CHECKS     Leave out the checks that the genetic operators make on
+					  their arguments every time they are called (see
+					  GA_CHECK in gaerror.h).  Off by default; the cmake
+					  option of the same name turns it on.
+
 ---------------------------------------------------------------------------- */
 
 // This is a bare-bones os-cpu-compiler detection with no dependencies on any
@@ -198,6 +208,11 @@ incorporate it into the code base.
 #define GALIB_USE_RAN2
 #endif
 
+// Unless told otherwise, the list and tree nodes come from the node pool.
+#if !defined(GALIB_NO_NODE_POOL)
+#define GALIB_USE_NODE_POOL
+#endif
+
 // This defines how many bits are in a single word on your system.  Most
 // systems have a word length of 8 bits.
 constexpr int GALIB_BITS_IN_WORD = 8;
@@ -215,6 +230,14 @@ using GALIB_BITBASE = long int;
 #define STA_CAST(type, x) (static_cast<type>(x))
 #define REI_CAST(type, x) (reinterpret_cast<type>(x))
 
+// Tell the compiler that two arrays do not overlap, so that it can vectorize
+// the loops over the elements of a genome.
+#if BOOST_COMP_MSVC
+#define GALIB_RESTRICT __restrict
+#else
+#define GALIB_RESTRICT __restrict__
+#endif
+
 
 /* ----------------------------------------------------------------------------
 DEFAULT OPERATORS
@@ -227,6 +250,7 @@ of the objects in GAlib.
 #define USE_SIGMA_TRUNC_SCALING 1
 #define USE_POWER_LAW_SCALING 1
 #define USE_SHARING 1
+#define USE_CLEARING 1
 
 // selection schemes
 #define USE_RANK_SELECTOR 1
@@ -294,6 +318,11 @@ of the objects in GAlib.
 #define DEFAULT_REAL_COMPARATOR ElementComparator
 #define DEFAULT_REAL_CROSSOVER UniformCrossover
 
+#define DEFAULT_REALES_INITIALIZER UniformInitializer
+#define DEFAULT_REALES_MUTATOR SelfAdaptiveMutator
+#define DEFAULT_REALES_COMPARATOR ElementComparator
+#define DEFAULT_REALES_CROSSOVER DiscreteCrossover
+
 #define DEFAULT_TREE_INITIALIZER NoInitializer
 #define DEFAULT_TREE_MUTATOR SwapSubtreeMutator
 #define DEFAULT_TREE_COMPARATOR TopologyComparator
@@ -15,6 +15,8 @@
 #include <gatypes.h>
 
 #include <ostream>
+#include <string>
+#include <string_view>
 
 // This object is for telling us where in the source code an error occurs.
 class GASourceLocator
@@ -66,6 +68,8 @@ enum class GAError
 	NegFitness,
 	PowerNegFitness,
 	BadSharingCutoff,
+	BadClearingRadius,
+	BadClearingCapacity,
 
 	// miscellaneous error messages from various data objects
 	NoAlleleIndex,
@@ -79,7 +83,11 @@ enum class GAError
 	CannotInsertOnNilNode,
 	CannotInsertWithSiblings,
 	CannotInsertBeforeRoot,
-	CannotInsertAfterRoot
+	CannotInsertAfterRoot,
+	BadTour,
+
+	// errors from the executor
+	ExecutorBusy
 };
 
 // Error messages will look like this: (assuming that you use streams)
@@ -99,30 +107,54 @@ enum class GAError
 //   /usr/people/algore/distribute_your_intelligence.C : XXX
 //
 
-void GAErr(const GASourceLocator loc, const std::string &clss,
-		   const std::string &function_name, GAError i,
-		   const std::string &msg2 = "",
-		   const std::string &msg3 = "");
-void GAErr(const GASourceLocator loc, const std::string &clss,
-		   const std::string &func, const std::string &msg1, const std::string &msg2 = "",
-		   const std::string &msg3 = "");
-void GAErr(const GASourceLocator loc, const std::string &function_name,
-		   GAError i,
-		   const std::string &msg2 = "", const std::string &msg3 = "");
+//   The names and messages are only looked at, not kept, so passing a literal
+// or a className() costs nothing.  The message is not put together unless it
+// is going to be reported (or someone asks for it with GALastErrorMessage).
+void GAErr(const GASourceLocator loc, std::string_view clss,
+		   std::string_view function_name, GAError i,
+		   std::string_view msg2 = {}, std::string_view msg3 = {});
+void GAErr(const GASourceLocator loc, std::string_view clss,
+		   std::string_view func, std::string_view msg1,
+		   std::string_view msg2 = {}, std::string_view msg3 = {});
+void GAErr(const GASourceLocator loc, std::string_view function_name,
+		   GAError i, std::string_view msg2 = {}, std::string_view msg3 = {});
 
 // Use this function to turn on/off the error reporting.  If you turn off the
-// error reporting, the messages will still get stuck into the global error
-// message string, but they will not be sent to the error stream.
+// error reporting, the errors are still recorded (see GALastError), but they
+// are not sent to the error stream.
 
 void GAReportErrors(bool flag);
 
-// Provide a mechanism for redirecting the error messages.
+// Provide a mechanism for redirecting the error messages.  Messages from
+// different threads are written one at a time.
 
 void GASetErrorStream(std::ostream &);
 
-// This error string contains the text of the most recent error message.  If a
-// GAlib function returns an error code, this string will contain the text of
-// the explanation for the error.
-static std::string gaErrMsg;
+// Each thread has its own record of the most recent error that it ran into.
+// If a GAlib function returns an error code, this is the explanation for it.
+// file is nullptr if there has been no error since the last GAClearError.
+// If coded is true then code is what went wrong, else msg1 says what did.
+struct GAErrorInfo
+{
+	const char *file = nullptr;
+	long line = 0;
+	bool coded = false;
+	GAError code = GAError::ReadError;
+	std::string clss, func, msg1, msg2, msg3;
+};
+
+const GAErrorInfo &GALastError();
+std::string GALastErrorMessage();
+void GAClearError();
+
+// The checks that the genetic operators make on every call (that the parents
+// and children are the same length, that a phenotype exists and so on) are
+// wrapped in GA_CHECK.  Define GALIB_NO_CHECKS to leave them out of code that
+// is known to call the operators correctly.
+#if defined(GALIB_NO_CHECKS)
+#define GA_CHECK(cond) (false)
+#else
+#define GA_CHECK(cond) (cond)
+#endif
 
 #endif
@@ -28,6 +28,8 @@ class GAID
 		SteadyStateGA,
 		IncrementalGA,
 		DemeGA,
+		StaticGA,
+		AsyncSteadyStateGA,
 
 		Population = 10,
 
@@ -37,6 +39,7 @@ class GAID
 		SigmaTruncationScaling,
 		PowerLawScaling,
 		Sharing,
+		Clearing,
 
 		Selection = 40,
 		RankSelection,
@@ -62,7 +65,10 @@ class GAID
 		StringGenome,
 		FloatGenome,
 		IntGenome,
-		DoubleGenome
+		DoubleGenome,
+		FlatTreeGenome,
+		ArrayListGenome,
+		RealESGenome
 	};
 
 	bool sameClass(const GAID &b) const { return (classID() == b.classID()); }
@@ -37,9 +37,27 @@ GAFlipCoin
 GAUnitGaussian
   Returns a number from a Gaussian distribution with mean 0 and stddev of 1
 
+GAUnitGaussians
+  Fill an array with n such numbers.  They are the same numbers that n calls
+to GAUnitGaussian would give, but both numbers of each pair go straight into
+the array.  The float version rounds each of them to float.
+
 GAGaussianFloat, GAGaussianDouble
   Scaled versions of the gaussian distribution.  You must specify a stddev,
 then these functions scale the distribution to that deviation.  Mean is still 0
+
+GAResumeRNG
+  Seed the generator as GAResetRNG does, but leave the seed that
+GAGetRandomSeed reports alone.  The library uses this when it splits a stream
+into several and then goes on with a new one, so that the seed the user gave
+is still the one that is reported.
+
+  Each thread has its own generator (and its own seed), so threads do not
+disturb each other's sequences.  A thread starts out unseeded, so a thread
+that needs random numbers should seed its generator with GAResetRNG first.
+The seed functions only touch the generator of the thread that calls them.
+(That is true of the Numerical Recipes generators.  RAND, RANDOM and RAND48
+use the state of the C library, which all threads share.)
 ---------------------------------------------------------------------------- */
 #ifndef _ga_random_h_
 #define _ga_random_h_
@@ -185,8 +203,11 @@ inline float GARandomFloat(float low, float high)
 unsigned int GAGetRandomSeed();
 void GARandomSeed(unsigned int seed = 0);
 void GAResetRNG(unsigned int seed);
+void GAResumeRNG(unsigned int seed);
 int GARandomBit();
 double GAUnitGaussian();
+void GAUnitGaussians(float *values, int n);
+void GAUnitGaussians(double *values, int n);
 
 inline bool GAFlipCoin(float p)
 {
@@ -0,0 +1,207 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GAArrayListGenome.hpp>
+#include <GAListGenome.hpp>
+#include <garandom.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// A random tour of the towns 0..n-1 in both kinds of list.
+static void randomTour(GAListGenome<int> &list, GAArrayListGenome<int> &array,
+					   int n)
+{
+	std::vector<int> towns(n);
+	std::iota(towns.begin(), towns.end(), 0);
+	for (int i = n - 1; i > 0; i--)
+	{
+		std::swap(towns[i], towns[GARandomInt(0, i)]);
+	}
+	for (int t : towns)
+	{
+		list.insert(t, GAListBASE::TAIL);
+		array.insert(t, GAListBASE::TAIL);
+	}
+}
+
+static bool sameList(const GAList<int> &list, const GAArrayList<int> &array)
+{
+	std::vector<int> contents;
+	GAListIter<int> iter(list);
+	if (iter.head() != nullptr)
+	{
+		contents.push_back(*iter.current());
+		for (int i = 1; i < list.size(); i++)
+		{
+			contents.push_back(*iter.next());
+		}
+	}
+	return contents == array.contents();
+}
+
+static bool isTour(const GAArrayList<int> &array, int n)
+{
+	std::vector<int> sorted(array.contents());
+	std::sort(sorted.begin(), sorted.end());
+	for (int i = 0; i < n; i++)
+	{
+		if (i >= (int)sorted.size() || sorted[i] != i)
+		{
+			return false;
+		}
+	}
+	return (int)sorted.size() == n;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+// The iterator must end up where the list iterator ends up.
+BOOST_AUTO_TEST_CASE(GAArrayList_iterator)
+{
+	GAResetRNG(17);
+	GAList<int> list;
+	GAArrayList<int> array;
+	for (int step = 0; step < 2000; step++)
+	{
+		int k = GARandomInt(0, 9);
+		int *a = nullptr, *b = nullptr;
+		if (k < 4)
+		{
+			auto where = static_cast<GAListBASE::Location>(GARandomInt(0, 3));
+			int v = GARandomInt(0, 50);
+			BOOST_CHECK_EQUAL(list.insert(v, where), array.insert(v, where));
+		}
+		else if (k == 4)
+		{
+			a = list.next();
+			b = array.next();
+		}
+		else if (k == 5)
+		{
+			a = list.prev();
+			b = array.prev();
+		}
+		else if (k == 6)
+		{
+			int i = GARandomInt(0, list.size());
+			a = list.warp(i);
+			b = array.warp(i);
+		}
+		else if (k == 7)
+		{
+			int i = GARandomInt(0, list.size() - 1);
+			int j = GARandomInt(0, list.size() - 1);
+			list.swap(i, j);
+			array.swap(i, j);
+		}
+		else if (k == 8)
+		{
+			a = list.remove();
+			b = array.remove();
+			BOOST_CHECK_EQUAL(a == nullptr, b == nullptr);
+			if (a && b)
+			{
+				BOOST_CHECK_EQUAL(*a, *b);
+			}
+			delete a;
+			delete b;
+			a = b = nullptr;
+		}
+		else
+		{
+			list.destroy();
+			array.destroy();
+		}
+		BOOST_CHECK_EQUAL(a == nullptr, b == nullptr);
+		int *x = list.current(), *y = array.current();
+		BOOST_REQUIRE_EQUAL(x == nullptr, y == nullptr);
+		if (x && y)
+		{
+			BOOST_REQUIRE_EQUAL(*x, *y);
+		}
+		BOOST_REQUIRE(sameList(list, array));
+	}
+}
+
+// With the same random numbers, the operators must do exactly what the list
+// operators do.
+BOOST_AUTO_TEST_CASE(GAArrayListGenome_operators)
+{
+	GAResetRNG(23);
+	GAListGenome<int> mom, dad;
+	GAArrayListGenome<int> amom, adad;
+	randomTour(mom, amom, 60);
+	randomTour(dad, adad, 60);
+	BOOST_CHECK_EQUAL(amom.position(*mom.warp(17)), 17);
+
+	GAGenome::SexualCrossover cross[][2] = {
+		{GAListGenome<int>::PartialMatchCrossover,
+		 GAArrayListGenome<int>::PartialMatchCrossover},
+		{GAListGenome<int>::OrderCrossover, GAArrayListGenome<int>::OrderCrossover},
+		{GAListGenome<int>::CycleCrossover, GAArrayListGenome<int>::CycleCrossover},
+		{GAListGenome<int>::OnePointCrossover,
+		 GAArrayListGenome<int>::OnePointCrossover}};
+	for (auto &c : cross)
+	{
+		for (int i = 0; i < 20; i++)
+		{
+			GAListGenome<int> sis, bro;
+			GAArrayListGenome<int> asis, abro;
+			GAResetRNG(300 + i);
+			(*c[0])(mom, dad, &sis, &bro);
+			GAResetRNG(300 + i);
+			(*c[1])(amom, adad, &asis, &abro);
+			BOOST_CHECK(sameList(sis, asis));
+			BOOST_CHECK(sameList(bro, abro));
+			BOOST_CHECK_EQUAL(GAArrayListGenome<int>::NodeComparator(asis, abro),
+							  GAListGenome<int>::NodeComparator(sis, bro));
+		}
+	}
+
+	GAGenome::Mutator muts[][2] = {
+		{GAListGenome<int>::SwapMutator, GAArrayListGenome<int>::SwapMutator},
+		{GAListGenome<int>::DestructiveMutator,
+		 GAArrayListGenome<int>::DestructiveMutator}};
+	for (auto &m : muts)
+	{
+		for (float pmut : {0.01f, 0.2f})
+		{
+			GAListGenome<int> l(mom);
+			GAArrayListGenome<int> a(amom);
+			GAResetRNG(9);
+			int n = (*m[0])(l, pmut);
+			GAResetRNG(9);
+			BOOST_CHECK_EQUAL((*m[1])(a, pmut), n);
+			BOOST_CHECK(sameList(l, a));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GAArrayListGenome_edgeRecombination)
+{
+	GAResetRNG(29);
+	GAListGenome<int> mom, dad;
+	GAArrayListGenome<int> amom, adad, asis, abro;
+	randomTour(mom, amom, 200);
+	randomTour(dad, adad, 200);
+	BOOST_CHECK_EQUAL(GAArrayListGenome<int>::EdgeRecombinationCrossover(
+						  amom, adad, &asis, &abro),
+					  2);
+	BOOST_CHECK(isTour(asis, 200));
+	BOOST_CHECK(isTour(abro, 200));
+
+	// Crossing a tour with itself gives the same tour (perhaps starting
+	// somewhere else, perhaps backwards).
+	GAArrayListGenome<int>::EdgeRecombinationCrossover(amom, amom, &asis, nullptr);
+	BOOST_REQUIRE(isTour(asis, 200));
+	const std::vector<int> &m = amom.contents(), &s = asis.contents();
+	int start = amom.position(s[0]);
+	bool forward = (m[(start + 1) % 200] == s[1]);
+	for (int i = 0; i < 200; i++)
+	{
+		BOOST_CHECK_EQUAL(s[i], m[(start + (forward ? i : 200 - i)) % 200]);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,154 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAAsyncGA.h>
+#include <GAExecutor.h>
+#include <garandom.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+static std::atomic<int> running(0), mostRunning(0), nEvaluations(0);
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+// The same objective, but it takes anything from nothing to 2 ms depending on
+// the genome, and keeps track of how many evaluations run at the same time.
+static float slowObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	int now = ++running;
+	int most = mostRunning;
+	while (now > most && !mostRunning.compare_exchange_weak(most, now))
+		;
+	int wait = 0;
+	for (int i = 0; i < 4; i++)
+		wait = 2 * wait + genome.gene(i);
+	std::this_thread::sleep_for(std::chrono::microseconds(wait * 130));
+	float score = onesObjective(g);
+	--running;
+	return score;
+}
+
+static float countedObjective(GAGenome &g)
+{
+	++nEvaluations;
+	return onesObjective(g);
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAAsyncSteadyStateGA_evolve)
+{
+	// The threads come from the executor, however many cores there are.
+	GAExecutor::instance().size(6);
+	GA1DBinaryStringGenome genome(40, slowObjective);
+	GAAsyncSteadyStateGA ga(genome);
+	ga.populationSize(30);
+	ga.nGenerations(400);
+	ga.nThreads(4);
+	ga.nInFlight(6);
+	ga.pMutation(0.01);
+	mostRunning = 0;
+	ga.evolve(71);
+
+	// The evaluations overlap, but there are never more of them than threads.
+	BOOST_CHECK_GT(mostRunning, 1);
+	BOOST_CHECK_LE(mostRunning, 4);
+	BOOST_CHECK_EQUAL(ga.population().size(), 30);
+	BOOST_CHECK_EQUAL(ga.statistics().generation(), 400);
+	BOOST_CHECK_GE(ga.statistics().bestIndividual().score(), 32);
+
+	// Each child that is inserted is evaluated.
+	for (int i = 0; i < ga.population().size(); i++)
+	{
+		GAGenome &g = ga.population().individual(i);
+		BOOST_CHECK(g.isEvaluated());
+		BOOST_CHECK_EQUAL(g.score(), onesObjective(g));
+	}
+	GAExecutor::instance().size(0);
+}
+
+// With one thread the children come back in the order they were sent, so the
+// run depends only on the seed.
+BOOST_AUTO_TEST_CASE(GAAsyncSteadyStateGA_oneThread)
+{
+	float best[2], ave[2];
+	for (int k = 0; k < 2; k++)
+	{
+		GA1DBinaryStringGenome genome(60, onesObjective);
+		GAAsyncSteadyStateGA ga(genome);
+		ga.populationSize(20);
+		ga.nGenerations(300);
+		ga.nThreads(1);
+		ga.nInFlight(3);
+		GAResetRNG(73);
+		ga.evolve();
+		best[k] = ga.statistics().bestIndividual().score();
+		ave[k] = ga.population().ave();
+	}
+	BOOST_CHECK_EQUAL(best[0], best[1]);
+	BOOST_CHECK_EQUAL(ave[0], ave[1]);
+}
+
+BOOST_AUTO_TEST_CASE(GAAsyncSteadyStateGA_parameters)
+{
+	GA1DBinaryStringGenome genome(20, onesObjective);
+	GAAsyncSteadyStateGA ga(genome);
+	int value = 3;
+	ga.set(gaNnThreads, value);
+	ga.set(gaSNnInFlight, 5);
+	BOOST_CHECK_EQUAL(ga.nThreads(), 3);
+	BOOST_CHECK_EQUAL(ga.nInFlight(), 5);
+	ga.get(gaSNnThreads, &value);
+	BOOST_CHECK_EQUAL(value, 3);
+
+	// Replacing a parent, with the parent sometimes gone by the time its
+	// child is back.
+	ga.populationSize(10);
+	ga.nGenerations(200);
+	ga.replacement(GAIncrementalGA::PARENT);
+	ga.evolve(79);
+	BOOST_CHECK_EQUAL(ga.population().size(), 10);
+
+	// A copy starts with nothing in flight.
+	GAAsyncSteadyStateGA other(ga);
+	BOOST_CHECK_EQUAL(other.nThreads(), 3);
+	other.nThreads(2);
+	other.initialize(79);
+	for (int i = 0; i < 50; i++)
+		other.step();
+	other.wait();
+	BOOST_CHECK_EQUAL(other.statistics().generation(), 50);
+}
+
+// The thread that steps evaluates one child while it waits, not every child
+// in the queue, so it can insert whichever child is done first.
+BOOST_AUTO_TEST_CASE(GAAsyncSteadyStateGA_helpsOneAtATime)
+{
+	GAExecutor::instance().size(1);
+	GA1DBinaryStringGenome genome(30, countedObjective);
+	GAAsyncSteadyStateGA ga(genome);
+	ga.populationSize(10);
+	ga.nThreads(1);
+	ga.nInFlight(4);
+	ga.initialize(83);
+	int before = nEvaluations;
+	ga.step();
+	BOOST_CHECK_EQUAL(nEvaluations - before, 1);
+	ga.step();
+	BOOST_CHECK_EQUAL(nEvaluations - before, 2);
+	ga.wait();
+	BOOST_CHECK_LE(nEvaluations - before, 5);
+	GAExecutor::instance().size(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GABatch.h>
+#include <GABin2DecGenome.h>
+#include <GASStateGA.h>
+#include <GAScaling.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// Match the numbers in the user data, as ex2 does.
+static float matchObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GABin2DecGenome &, g);
+	auto *target = STA_CAST(const float *, genome.userData());
+	float value = genome.nPhenotypes();
+	for (int i = 0; i < genome.nPhenotypes(); i++)
+		value -= std::fabs(genome.phenotype(i) - target[i]) / 10;
+	return value;
+}
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+static void sigmaSetup(GAGeneticAlgorithm &ga)
+{
+	ga.scaling(GASigmaTruncationScaling());
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+// A run gets the same answer on any number of threads, with a new GA or a
+// used one, as it does with a GA of its own.
+BOOST_AUTO_TEST_CASE(GABatch_runs)
+{
+	GAResetRNG(11);
+	GABin2DecPhenotype map;
+	for (int i = 0; i < 3; i++)
+		map.add(10, 0, 5);
+
+	const int NFITS = 12;
+	std::vector<std::vector<float>> targets(NFITS);
+	std::vector<std::unique_ptr<GABin2DecGenome>> fits;
+	for (int k = 0; k < NFITS; k++)
+	{
+		for (int i = 0; i < 3; i++)
+			targets[k].push_back(GARandomFloat(0, 5));
+		fits.emplace_back(new GABin2DecGenome(map, matchObjective, targets[k].data()));
+	}
+	std::vector<std::unique_ptr<GA1DBinaryStringGenome>> strings;
+	for (int length : {20, 31, 20})
+		strings.emplace_back(new GA1DBinaryStringGenome(length, onesObjective));
+
+	GAParameterList small, steady;
+	GASimpleGA::registerDefaultParameters(small);
+	small.set(gaNpopulationSize, 20);
+	small.set(gaNnGenerations, 15);
+	GASteadyStateGA::registerDefaultParameters(steady);
+	steady.set(gaNpopulationSize, 16);
+	steady.set(gaNnGenerations, 10);
+	steady.set(gaNminimaxi, GAGeneticAlgorithm::MINIMIZE);
+
+	std::vector<GABatch::Run> runs;
+	for (int k = 0; k < NFITS; k++)
+	{
+		GABatch::Run r;
+		r.genome = fits[k].get();
+		r.parameters = (k % 3 == 2 ? steady : small);
+		r.maker = (k % 3 == 2 ? GABatch::Make<GASteadyStateGA> : nullptr);
+		runs.push_back(r);
+	}
+	for (auto &g : strings)
+	{
+		GABatch::Run r;
+		r.genome = g.get();
+		r.parameters = small;
+		r.setup = sigmaSetup;
+		r.seed = 77;
+		runs.push_back(r);
+	}
+
+	std::vector<float> best[2];
+	for (int t = 0; t < 2; t++)
+	{
+		GABatch batch(t == 0 ? 1 : 4);
+		batch.seed(5);
+		for (int round = 0; round < 2; round++)
+		{
+			batch.clear();
+			for (const GABatch::Run &r : runs)
+				batch.add(r);
+			batch.evolve();
+			for (int i = 0; i < batch.size(); i++)
+			{
+				BOOST_REQUIRE(batch.result(i).done);
+				BOOST_REQUIRE(batch.result(i).best != nullptr);
+				if (round == 0)
+					best[t].push_back(batch.result(i).best->score());
+				else
+					BOOST_CHECK_EQUAL(batch.result(i).best->score(), best[t][i]);
+			}
+		}
+		BOOST_CHECK_GE(batch.nReused(), batch.size());
+		BOOST_CHECK_EQUAL(batch.result(NFITS).seed, 77u);
+		auto length = [&](int i)
+		{ return STA_CAST(const GA1DBinaryStringGenome &, *batch.result(i).best).length(); };
+		BOOST_CHECK_EQUAL(length(NFITS), 20);
+		BOOST_CHECK_EQUAL(length(NFITS + 1), 31);
+
+		// Each run against a GA of its own.
+		for (int i = 0; i < batch.size(); i++)
+		{
+			const GABatch::Run &r = batch.run(i);
+			std::unique_ptr<GAGeneticAlgorithm> ga(
+				r.maker != nullptr ? (*r.maker)(*r.genome) : new GASimpleGA(*r.genome));
+			ga->parameters(r.parameters);
+			if (r.setup != nullptr)
+				(*r.setup)(*ga);
+			GAResetRNG(batch.result(i).seed);
+			ga->evolve();
+			BOOST_CHECK_EQUAL(ga->statistics().bestIndividual().score(),
+							  batch.result(i).best->score());
+			BOOST_CHECK_EQUAL(ga->statistics().online(),
+							  batch.result(i).statistics.online());
+			BOOST_CHECK_EQUAL(ga->statistics().generation(),
+							  batch.result(i).statistics.generation());
+		}
+	}
+	BOOST_CHECK(best[0] == best[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
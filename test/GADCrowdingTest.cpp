@@ -0,0 +1,134 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GADCrowdingGA.h>
+#include <GAThreadPool.h>
+#include <garandom.h>
+
+#include <atomic>
+#include <vector>
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAThreadPool_run)
+{
+	GAThreadPool pool(4);
+	BOOST_CHECK_EQUAL(pool.size(), 4);
+	for (int njobs : {0, 1, 3, 1000})
+	{
+		std::vector<std::atomic<int>> done(njobs);
+		std::atomic<int> badWorker(0);
+		pool.run(njobs,
+				 [&](int job, int worker)
+				 {
+					 done[job]++;
+					 if (worker < 0 || worker >= 4)
+						 badWorker++;
+				 });
+		for (int i = 0; i < njobs; i++)
+			BOOST_CHECK_EQUAL(done[i], 1);
+		BOOST_CHECK_EQUAL(badWorker, 0);
+	}
+
+	// A pool that changes size starts over with the right number of workers.
+	pool.size(2);
+	std::atomic<int> most(0);
+	pool.run(100,
+			 [&](int, int worker)
+			 {
+				 int m = most;
+				 while (worker > m && !most.compare_exchange_weak(m, worker))
+					 ;
+			 });
+	BOOST_CHECK_LE(most, 1);
+}
+
+// The answer depends on the seed, not on the number of threads.
+BOOST_AUTO_TEST_CASE(GADCrowdingGA_threads)
+{
+	std::vector<float> scores[3];
+	unsigned int threads[3] = {1, 3, 8};
+	for (int k = 0; k < 3; k++)
+	{
+		GA1DBinaryStringGenome genome(50, onesObjective);
+		GADCrowdingGA ga(genome);
+		ga.populationSize(101);
+		ga.nGenerations(40);
+		ga.pMutation(0.02);
+		ga.nThreads(threads[k]);
+		BOOST_CHECK_EQUAL(ga.nThreads(), threads[k]);
+		GAResetRNG(83);
+		ga.evolve();
+		for (int i = 0; i < ga.population().size(); i++)
+			scores[k].push_back(ga.population().individual(i).score());
+		BOOST_CHECK_EQUAL(ga.population().size(), 101);
+		BOOST_CHECK_EQUAL(ga.statistics().selections(), 40 * 100);
+	}
+	BOOST_CHECK(scores[0] == scores[1]);
+	BOOST_CHECK(scores[0] == scores[2]);
+}
+
+// A child only replaces a parent that is worse, so nobody gets worse.
+BOOST_AUTO_TEST_CASE(GADCrowdingGA_replacement)
+{
+	GA1DBinaryStringGenome genome(40, onesObjective);
+	GADCrowdingGA ga(genome);
+	ga.populationSize(40);
+	ga.set(gaSNnThreads, 4);
+	int value = 0;
+	ga.get(gaNnThreads, &value);
+	BOOST_CHECK_EQUAL(value, 4);
+	GAResetRNG(89);
+	ga.initialize();
+	float ave = ga.population().ave();
+	for (int g = 0; g < 30; g++)
+	{
+		ga.step();
+		BOOST_CHECK_GE(ga.population().ave(), ave);
+		ave = ga.population().ave();
+	}
+
+	ga.minimaxi(GAGeneticAlgorithm::MINIMIZE);
+	for (int g = 0; g < 30; g++)
+	{
+		ga.step();
+		BOOST_CHECK_LE(ga.population().ave(), ave);
+		ave = ga.population().ave();
+	}
+}
+
+// The GA keeps the seed it was given, and the work of the batches is charged
+// to the phases it belongs to.
+BOOST_AUTO_TEST_CASE(GADCrowdingGA_seedAndTimings)
+{
+	GA1DBinaryStringGenome genome(200, onesObjective);
+	GADCrowdingGA ga(genome);
+	ga.populationSize(200);
+	ga.nThreads(4);
+	ga.recordTiming(true);
+	GAResetRNG(97);
+	ga.initialize(97);
+	for (int g = 0; g < 5; g++)
+	{
+		ga.step();
+		BOOST_CHECK_EQUAL(GAGetRandomSeed(), 97U);
+	}
+
+	const GAStatistics &stats = ga.statistics();
+	BOOST_CHECK_GT(stats.phaseTime(GAStatistics::Phase::Crossover), 0.0);
+	BOOST_CHECK_GT(stats.phaseTime(GAStatistics::Phase::Mutation), 0.0);
+	BOOST_CHECK_GT(stats.phaseTime(GAStatistics::Phase::Evaluation), 0.0);
+	BOOST_CHECK_GT(stats.phaseTime(GAStatistics::Phase::Replacement), 0.0);
+	BOOST_CHECK_GE(stats.phaseTime(GAStatistics::Phase::Other), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,209 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static int nfull = 0, ndelta = 0;
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	nfull++;
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+static float onesDelta(GAGenome &g, float previous, const unsigned int *changed,
+					   int n)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	ndelta++;
+	for (int k = 0; k < n; k++)
+		previous += genome.gene(changed[k]) - genome.previous(changed[k]);
+	return previous;
+}
+
+// The towns are on a circle, so the distance between two of them depends only
+// on how far apart their numbers are.
+static const int NTOWNS = 200;
+static float distance(int a, int b)
+{
+	return 2 * std::sin(M_PI * std::abs(a - b) / NTOWNS);
+}
+
+static float tourObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DArrayGenome<int> &, g);
+	nfull++;
+	float length = 0;
+	for (int i = 0; i < genome.length(); i++)
+		length += distance(genome.gene(i), genome.gene((i + 1) % genome.length()));
+	return length;
+}
+
+// Only the edges that start at a changed town or just before one are
+// different.
+static float tourDelta(GAGenome &g, float previous, const unsigned int *changed,
+					   int n)
+{
+	auto &genome = STA_CAST(GA1DArrayGenome<int> &, g);
+	ndelta++;
+	int len = genome.length();
+	std::vector<int> edges;
+	for (int k = 0; k < n; k++)
+	{
+		edges.push_back(changed[k]);
+		edges.push_back((changed[k] + len - 1) % len);
+	}
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+	for (int i : edges)
+	{
+		int j = (i + 1) % len;
+		previous += distance(genome.gene(i), genome.gene(j)) -
+					distance(genome.previous(i), genome.previous(j));
+	}
+	return previous;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAGenome_deltaEvaluation)
+{
+	GAResetRNG(43);
+	GA1DBinaryStringGenome genome(500, onesObjective);
+	genome.deltaEvaluator(onesDelta);
+	genome.initialize();
+	nfull = ndelta = 0;
+	float score = genome.score();
+	BOOST_CHECK_EQUAL(nfull, 1);
+
+	// A few flips are a delta evaluation.  The score stays right.
+	for (int k = 0; k < 20; k++)
+	{
+		GA1DBinaryStringGenome::FlipMutator(genome, 0.005);
+		BOOST_CHECK_LE(genome.nchanges(), GAGenome::MAX_CHANGES);
+		score = genome.score();
+		BOOST_CHECK(genome.isEvaluated());
+		BOOST_CHECK_EQUAL(score, onesObjective(genome));
+		nfull--;
+	}
+	BOOST_CHECK_EQUAL(nfull, 1);
+	BOOST_CHECK_EQUAL(ndelta, 20);
+
+	// A bit that is flipped twice is in the log once, with its first value.
+	short old = genome.gene(7);
+	genome.gene(7, 1 - old);
+	genome.gene(7, old);
+	BOOST_CHECK(!genome.isEvaluated());
+	BOOST_CHECK_EQUAL(genome.nchanges(), 1);
+	BOOST_CHECK_EQUAL(genome.previous(7), old);
+	BOOST_CHECK_EQUAL(genome.score(), score);
+
+	// A copy starts from the parent's score and keeps its changes.
+	GA1DBinaryStringGenome child(genome);
+	child.gene(3, 1 - child.gene(3));
+	BOOST_CHECK_EQUAL(child.nchanges(), 1);
+	GA1DBinaryStringGenome other(child);
+	BOOST_CHECK_EQUAL(other.nchanges(), 1);
+	BOOST_CHECK_EQUAL(other.score(), onesObjective(genome) + child.gene(3) -
+										 genome.gene(3));
+	BOOST_CHECK_EQUAL(ndelta, 22);
+	nfull = 1;
+
+	// Too many changes or a forced evaluation use the objective.
+	for (int i = 0; i <= GAGenome::MAX_CHANGES; i++)
+		genome.gene(i, 1 - genome.gene(i));
+	BOOST_CHECK_EQUAL(genome.nchanges(), 0);
+	genome.score();
+	BOOST_CHECK_EQUAL(nfull, 2);
+	genome.gene(0, 1 - genome.gene(0));
+	genome.evaluate(true);
+	BOOST_CHECK_EQUAL(nfull, 3);
+	BOOST_CHECK_EQUAL(genome.nchanges(), 0);
+	BOOST_CHECK_EQUAL(ndelta, 22);
+
+	// A crossover only logs the bits that it actually changes.
+	GA1DBinaryStringGenome::UniformCrossover(genome, child, &other, nullptr);
+	BOOST_CHECK_EQUAL(other.score(), onesObjective(other));
+
+	// No delta evaluator, no log.
+	genome.deltaEvaluator(nullptr);
+	genome.score();
+	genome.gene(0, 1 - genome.gene(0));
+	BOOST_CHECK_EQUAL(genome.nchanges(), 0);
+	BOOST_CHECK(!genome.isEvaluated());
+}
+
+BOOST_AUTO_TEST_CASE(GA1DArrayGenome_deltaEvaluation)
+{
+	GAResetRNG(47);
+	GA1DArrayGenome<int> tour(NTOWNS, tourObjective);
+	tour.deltaEvaluator(tourDelta);
+	for (int i = 0; i < NTOWNS; i++)
+		tour.gene(i, i);
+	for (int i = NTOWNS - 1; i > 0; i--)
+		tour.swap(i, GARandomInt(0, i));
+	nfull = ndelta = 0;
+	tour.score();
+
+	for (int k = 0; k < 50; k++)
+	{
+		GA1DArrayGenome<int>::SwapMutator(tour, 0.01);
+		float score = tour.score();
+		BOOST_CHECK_CLOSE(score, tourObjective(tour), 1e-2);
+		nfull--;
+	}
+	BOOST_CHECK_EQUAL(nfull, 1);
+	BOOST_CHECK_EQUAL(ndelta, 50);
+
+	// The crossovers that start from a raw copy of a parent must not be
+	// mistaken for a few changes to the child.
+	GA1DArrayGenome<int> mom(tour), dad(tour), sis(tour);
+	for (int i = NTOWNS - 1; i > 0; i--)
+		dad.swap(i, GARandomInt(0, i));
+	dad.evaluate(true);
+	sis.score();
+	GA1DArrayGenome<int>::PartialMatchCrossover(mom, dad, &sis, nullptr);
+	BOOST_CHECK_CLOSE(sis.score(), tourObjective(sis), 1e-2);
+	GA1DArrayGenome<int>::OrderCrossover(mom, dad, &sis, nullptr);
+	BOOST_CHECK_CLOSE(sis.score(), tourObjective(sis), 1e-2);
+}
+
+// A GA gets the same answers with the delta evaluator, with fewer full
+// evaluations.
+BOOST_AUTO_TEST_CASE(GASimpleGA_deltaEvaluation)
+{
+	float best[2];
+	int full[2];
+	for (int delta = 0; delta < 2; delta++)
+	{
+		GA1DBinaryStringGenome genome(200, onesObjective);
+		if (delta)
+			genome.deltaEvaluator(onesDelta);
+		GASimpleGA ga(genome);
+		ga.populationSize(20);
+		ga.nGenerations(30);
+		ga.pMutation(0.01);
+		ga.pCrossover(0.5);
+		GAResetRNG(53);
+		nfull = ndelta = 0;
+		ga.evolve();
+		best[delta] = ga.statistics().bestIndividual().score();
+		full[delta] = nfull;
+		if (delta)
+			BOOST_CHECK_GT(ndelta, 0);
+	}
+	BOOST_CHECK_EQUAL(best[0], best[1]);
+	BOOST_CHECK_LT(full[1], full[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GAArrayListGenome.hpp>
+#include <GAListGenome.hpp>
+#include <garandom.h>
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+static std::vector<int> randomTour(int n)
+{
+	std::vector<int> tour(n);
+	std::iota(tour.begin(), tour.end(), 0);
+	for (int i = n - 1; i > 0; i--)
+	{
+		std::swap(tour[i], tour[GARandomInt(0, i)]);
+	}
+	return tour;
+}
+
+static bool isTour(std::vector<int> tour)
+{
+	std::sort(tour.begin(), tour.end());
+	for (int i = 0; i < (int)tour.size(); i++)
+	{
+		if (tour[i] != i)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// The distance the way ex26 used to count it:  one connection matrix for each
+// tour, then the number of edges that are not in both.
+static int matrixDistance(const std::vector<int> &a, const std::vector<int> &b)
+{
+	int n = a.size();
+	std::vector<char> ma(n * n, 0), mb(n * n, 0);
+	for (int i = 0; i < n; i++)
+	{
+		int j = (i + 1) % n;
+		ma[a[i] * n + a[j]] = ma[a[j] * n + a[i]] = 1;
+		mb[b[i] * n + b[j]] = mb[b[j] * n + b[i]] = 1;
+	}
+	int dist = n;
+	for (int i = 0; i < n; i++)
+	{
+		for (int j = i; j < n; j++)
+		{
+			if (ma[i * n + j] && mb[i * n + j])
+			{
+				dist--;
+			}
+		}
+	}
+	return dist;
+}
+
+static std::vector<int> listContents(GAListGenome<int> &list)
+{
+	std::vector<int> v;
+	if (list.head())
+	{
+		v.push_back(*list.current());
+		for (int i = 1; i < list.size(); i++)
+		{
+			v.push_back(*list.next());
+		}
+	}
+	list.head();
+	return v;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAEdgeRecombination_tours)
+{
+	GAResetRNG(31);
+	const int n = 300;
+	std::vector<int> mom = randomTour(n), dad = randomTour(n), child(n);
+
+	// Most of the child's edges come from the parents.  The rest are the
+	// jumps we make when all the neighbours are taken.
+	BOOST_REQUIRE(GAEdgeRecombination(mom.data(), dad.data(), n, child.data()));
+	BOOST_CHECK(isTour(child));
+	BOOST_CHECK_LT(GAEdgeDistance(child.data(), mom.data(), n) +
+					   GAEdgeDistance(child.data(), dad.data(), n) - n,
+				   n / 10);
+
+	// A tour crossed with itself (or with itself backwards) is the same tour.
+	std::vector<int> back(mom.rbegin(), mom.rend());
+	BOOST_REQUIRE(GAEdgeRecombination(mom.data(), back.data(), n, child.data()));
+	BOOST_CHECK_EQUAL(GAEdgeDistance(child.data(), mom.data(), n), 0);
+
+	// Parents that are not tours of the same towns.
+	std::vector<int> other(dad);
+	other[5] = other[6];
+	BOOST_CHECK(!GAEdgeRecombination(mom.data(), other.data(), n, child.data()));
+	other[5] = n + 3;
+	BOOST_CHECK(!GAEdgeRecombination(mom.data(), other.data(), n, child.data()));
+	other[5] = -1;
+	BOOST_CHECK(!GAEdgeRecombination(mom.data(), other.data(), n, child.data()));
+
+	int one = 7;
+	BOOST_CHECK(GAEdgeRecombination(&one, &one, 1, child.data()));
+	BOOST_CHECK_EQUAL(child[0], 7);
+}
+
+BOOST_AUTO_TEST_CASE(GAEdgeDistance_matrix)
+{
+	GAResetRNG(37);
+	for (int n : {3, 4, 10, 57})
+	{
+		for (int k = 0; k < 20; k++)
+		{
+			std::vector<int> a = randomTour(n), b = randomTour(n);
+			BOOST_CHECK_EQUAL(GAEdgeDistance(a.data(), b.data(), n), matrixDistance(a, b));
+		}
+		std::vector<int> a = randomTour(n), b(a);
+		std::rotate(b.begin(), b.begin() + n / 2, b.end());
+		std::reverse(b.begin(), b.end());
+		BOOST_CHECK_EQUAL(GAEdgeDistance(a.data(), b.data(), n), 0);
+	}
+}
+
+// The genomes all use the same edge recombination, so with the same random
+// numbers they make the same children.
+BOOST_AUTO_TEST_CASE(GAGenome_edgeRecombination)
+{
+	GAResetRNG(41);
+	const int n = 120;
+	std::vector<int> x = randomTour(n), y = randomTour(n);
+	GA1DArrayGenome<int> amom(n), adad(n), asis(n), abro(n);
+	GAListGenome<int> lmom, ldad, lsis, lbro;
+	GAArrayListGenome<int> vmom, vdad, vsis, vbro;
+	for (int i = 0; i < n; i++)
+	{
+		amom.gene(i, x[i]);
+		adad.gene(i, y[i]);
+		lmom.insert(x[i], GAListBASE::TAIL);
+		ldad.insert(y[i], GAListBASE::TAIL);
+		vmom.insert(x[i], GAListBASE::TAIL);
+		vdad.insert(y[i], GAListBASE::TAIL);
+	}
+
+	for (int k = 0; k < 5; k++)
+	{
+		GAResetRNG(700 + k);
+		BOOST_CHECK_EQUAL(
+			GA1DArrayGenome<int>::EdgeRecombinationCrossover(amom, adad, &asis, &abro), 2);
+		GAResetRNG(700 + k);
+		BOOST_CHECK_EQUAL(
+			GAListGenome<int>::EdgeRecombinationCrossover(lmom, ldad, &lsis, &lbro), 2);
+		GAResetRNG(700 + k);
+		BOOST_CHECK_EQUAL(
+			GAArrayListGenome<int>::EdgeRecombinationCrossover(vmom, vdad, &vsis, &vbro), 2);
+
+		std::vector<int> sis(&asis.gene(0), &asis.gene(0) + n);
+		std::vector<int> bro(&abro.gene(0), &abro.gene(0) + n);
+		BOOST_CHECK(isTour(sis));
+		BOOST_CHECK(isTour(bro));
+		BOOST_CHECK(listContents(lsis) == sis);
+		BOOST_CHECK(listContents(lbro) == bro);
+		BOOST_CHECK(vsis.contents() == sis);
+		BOOST_CHECK(vbro.contents() == bro);
+
+		float d = matrixDistance(sis, bro);
+		BOOST_CHECK_EQUAL(GAListGenome<int>::EdgeComparator(lsis, lbro), d);
+		BOOST_CHECK_EQUAL(GAArrayListGenome<int>::EdgeComparator(vsis, vbro), d);
+		BOOST_CHECK_CLOSE(GA1DArrayGenome<int>::EdgeComparator(asis, abro), d / n, 1e-4);
+	}
+
+	// The unchecked version does the same thing.
+	GAGenome::SexualCrossover unchecked =
+		amom.uncheckedCrossover(GA1DArrayGenome<int>::EdgeRecombinationCrossover);
+	BOOST_REQUIRE(unchecked != nullptr);
+	GA1DArrayGenome<int> usis(n);
+	GAResetRNG(9);
+	(*unchecked)(amom, adad, &usis, nullptr);
+	GAResetRNG(9);
+	GA1DArrayGenome<int>::EdgeRecombinationCrossover(amom, adad, &asis, nullptr);
+	BOOST_CHECK(usis == asis);
+
+	// Parents that are not tours get an error and no children.
+	std::ostringstream err;
+	GASetErrorStream(err);
+	adad.gene(0, adad.gene(1));
+	BOOST_CHECK_EQUAL(
+		GA1DArrayGenome<int>::EdgeRecombinationCrossover(amom, adad, &asis, &abro), 0);
+	GASetErrorStream(std::cerr);
+	BOOST_CHECK(err.str().find("tours") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
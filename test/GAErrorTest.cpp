@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <gaerror.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAErr_lastError)
+{
+	std::ostringstream os;
+	GASetErrorStream(os);
+	GAClearError();
+	BOOST_CHECK(GALastError().file == nullptr);
+	BOOST_CHECK_EQUAL(GALastErrorMessage(), "");
+
+	GAErr(GA_LOC, "GAThing", "frob", GAError::BadProbValue, "more");
+	const GAErrorInfo &e = GALastError();
+	BOOST_REQUIRE(e.file != nullptr);
+	BOOST_CHECK(e.coded);
+	BOOST_CHECK(e.code == GAError::BadProbValue);
+	BOOST_CHECK_EQUAL(e.clss, "GAThing");
+	BOOST_CHECK_EQUAL(e.func, "frob");
+	BOOST_CHECK_EQUAL(e.msg2, "more");
+	std::string message = GALastErrorMessage();
+	BOOST_CHECK_EQUAL(message.find("GAThing::frob:\nbad probability value."), 0u);
+	BOOST_CHECK(message.find("  more\n") != std::string::npos);
+	BOOST_CHECK_EQUAL(os.str(), message);
+
+	// Nothing is written when reporting is off, but the error is still kept.
+	GAReportErrors(false);
+	std::string name = "frobnicate";
+	GAErr(GA_LOC, "GAThing", name, "it went " + std::string("wrong"));
+	GAReportErrors(true);
+	BOOST_CHECK_EQUAL(os.str(), message);
+	BOOST_CHECK(!GALastError().coded);
+	BOOST_CHECK_EQUAL(GALastError().msg1, "it went wrong");
+	BOOST_CHECK_EQUAL(GALastErrorMessage().find("GAThing::frobnicate:\nit went wrong\n"), 0u);
+
+	GAErr(GA_LOC, "frob", GAError::OpUndef);
+	BOOST_CHECK_EQUAL(GALastErrorMessage().find("frob:\nthis method has not been defined.\n  "), 0u);
+
+	GAClearError();
+	BOOST_CHECK(GALastError().file == nullptr);
+	GASetErrorStream(std::cerr);
+}
+
+// Each thread sees its own errors.
+BOOST_AUTO_TEST_CASE(GAErr_threads)
+{
+	GAReportErrors(false);
+	GAClearError();
+	std::string other;
+	std::thread t(
+		[&]
+		{
+			GAErr(GA_LOC, "GAOther", "run", GAError::BadTour);
+			other = GALastError().clss;
+		});
+	t.join();
+	BOOST_CHECK_EQUAL(other, "GAOther");
+	BOOST_CHECK(GALastError().file == nullptr);
+	GAReportErrors(true);
+}
+
+// The operators check their arguments unless the checks are compiled out.
+BOOST_AUTO_TEST_CASE(GAErr_checks)
+{
+	GA1DBinaryStringGenome mom(10), dad(12), sis(10), bro(10);
+	GAReportErrors(false);
+	GAClearError();
+	int n = GA1DBinaryStringGenome::OnePointCrossover(mom, dad, &sis, &bro);
+	GAReportErrors(true);
+#if defined(GALIB_NO_CHECKS)
+	BOOST_CHECK(GALastError().file == nullptr);
+#else
+	BOOST_CHECK_EQUAL(n, 0);
+	BOOST_CHECK(GALastError().code == GAError::SameLengthReqd);
+	BOOST_CHECK_EQUAL(GALastError().func, "one-point cross");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
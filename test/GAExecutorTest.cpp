@@ -0,0 +1,169 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAAsyncGA.h>
+#include <GAExecutor.h>
+#include <GAThreadPool.h>
+#include <garandom.h>
+#include <gaerror.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAExecutor_groups)
+{
+	GAExecutor &executor = GAExecutor::instance();
+	for (unsigned int size : {1, 4})
+	{
+		executor.size(size);
+		BOOST_CHECK_EQUAL(executor.size(), size);
+
+		std::atomic<int> count(0);
+		GAExecutor::Group group;
+		BOOST_CHECK(!executor.help(group));
+		for (int i = 0; i < 100; i++)
+			executor.submit(group, [&count] { count++; });
+		executor.wait(group);
+		BOOST_CHECK_EQUAL(count, 100);
+		BOOST_CHECK_EQUAL(group.size(), 0);
+
+		// With one thread there are no workers, so nobody has started on these
+		// and they are all dropped.  Otherwise some of them may have run.
+		count = 0;
+		for (int i = 0; i < 10; i++)
+			executor.submit(group, [&count] { count++; });
+		executor.cancel(group);
+		BOOST_CHECK_EQUAL(group.size(), 0);
+		BOOST_CHECK_LE(count, 10);
+		if (size == 1)
+			BOOST_CHECK_EQUAL(count, 0);
+	}
+	executor.size(0);
+}
+
+// Pools inside the jobs of pools (even the same one) do not deadlock, however
+// few threads there are.
+BOOST_AUTO_TEST_CASE(GAExecutor_nested)
+{
+	GAExecutor &executor = GAExecutor::instance();
+	for (unsigned int size : {1, 2, 4})
+	{
+		executor.size(size);
+		GAThreadPool pool(3);
+		std::atomic<int> count(0);
+		pool.run(6,
+				 [&](int, int)
+				 {
+					 GAThreadPool inner;
+					 inner.run(5,
+							   [&](int, int)
+							   {
+								   pool.run(4, [&](int, int) { count++; });
+							   });
+				 });
+		BOOST_CHECK_EQUAL(count, 6 * 5 * 4);
+	}
+	executor.pinned(true);
+	BOOST_CHECK(executor.pinned());
+	GAThreadPool pool;
+	std::atomic<int> count(0);
+	pool.run(50, [&](int, int) { count++; });
+	BOOST_CHECK_EQUAL(count, 50);
+	executor.pinned(false);
+	executor.size(0);
+}
+
+// Inlined, everything happens right away on the calling thread, so even an
+// asynchronous GA with several threads is reproducible.
+BOOST_AUTO_TEST_CASE(GAExecutor_inlined)
+{
+	GAExecutor &executor = GAExecutor::instance();
+	executor.size(4);
+	executor.inlined(true);
+
+	std::atomic<int> count(0);
+	GAExecutor::Group group;
+	executor.submit(group, [&count] { count++; });
+	BOOST_CHECK_EQUAL(count, 1);
+	BOOST_CHECK_EQUAL(group.size(), 0);
+
+	std::vector<int> order;
+	GAThreadPool pool(4);
+	pool.run(10, [&](int job, int worker) { order.push_back(10 * job + worker); });
+	BOOST_REQUIRE_EQUAL(order.size(), 10);
+	for (int i = 0; i < 10; i++)
+		BOOST_CHECK_EQUAL(order[i], 10 * i);
+
+	float best[2], ave[2];
+	for (int k = 0; k < 2; k++)
+	{
+		GA1DBinaryStringGenome genome(60, onesObjective);
+		GAAsyncSteadyStateGA ga(genome);
+		ga.populationSize(20);
+		ga.nGenerations(200);
+		ga.nThreads(4);
+		ga.nInFlight(6);
+		GAResetRNG(19);
+		ga.evolve();
+		best[k] = ga.statistics().bestIndividual().score();
+		ave[k] = ga.population().ave();
+	}
+	BOOST_CHECK_EQUAL(best[0], best[1]);
+	BOOST_CHECK_EQUAL(ave[0], ave[1]);
+
+	executor.inlined(false);
+	executor.size(0);
+}
+
+// The size cannot be changed by a task, nor while a group has tasks.
+BOOST_AUTO_TEST_CASE(GAExecutor_busy)
+{
+	GAExecutor &executor = GAExecutor::instance();
+	executor.size(3);
+	GAReportErrors(false);
+
+	std::atomic<bool> refused(false), release(false);
+	GAExecutor::Group group;
+	for (int i = 0; i < 4; i++)
+		executor.submit(group,
+						[&]
+						{
+							GAClearError();
+							executor.size(2);
+							if (GALastError().file != nullptr &&
+								GALastError().code == GAError::ExecutorBusy)
+								refused = true;
+							while (!release)
+								std::this_thread::yield();
+						});
+	GAClearError();
+	executor.size(5);
+	executor.pinned(!executor.pinned());
+	BOOST_CHECK(GALastError().code == GAError::ExecutorBusy);
+	BOOST_CHECK_EQUAL(executor.size(), 3u);
+	BOOST_CHECK(!executor.pinned());
+	release = true;
+	executor.wait(group);
+	BOOST_CHECK(refused);
+	BOOST_CHECK_EQUAL(executor.size(), 3u);
+
+	// Once the tasks are done it can be changed again.
+	GAClearError();
+	executor.size(0);
+	BOOST_CHECK(GALastError().file == nullptr);
+	GAReportErrors(true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
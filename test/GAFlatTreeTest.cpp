@@ -0,0 +1,167 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GAFlatTreeGenome.hpp>
+#include <GATreeGenome.hpp>
+#include <garandom.h>
+
+// A random tree:  each new node goes below or after a randomly chosen node.
+static void buildFlatTree(GATree<int> &tree, int n)
+{
+	tree.insert(0, GATreeBASE::ROOT);
+	for (int i = 1; i < n; i++)
+	{
+		int k = GARandomInt(0, tree.size() - 1);
+		tree.warp(k);
+		tree.insert(i, (k == 0 || GARandomBit()) ? GATreeBASE::BELOW
+												  : GATreeBASE::AFTER);
+	}
+	tree.root();
+}
+
+// Same contents and shape, node for node.
+static bool sameTree(const GAFlatTree<int> &flat, const GATree<int> &tree)
+{
+	GAFlatTree<int> expected(tree);
+	if (flat.size() != expected.size())
+	{
+		return false;
+	}
+	for (int i = 0; i < flat.size(); i++)
+	{
+		if (flat[i] != expected[i] || flat.extent(i) != expected.extent(i) ||
+			flat.level(i) != expected.level(i))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// The sum of the leaves, found by walking the children of each node.
+static int sumLeaves(const GAFlatTree<int> &t, unsigned int i)
+{
+	if (t.extent(i) == 1)
+	{
+		return t[i];
+	}
+	int sum = 0;
+	for (unsigned int c = i + 1; c < t.skip(i); c = t.skip(c))
+	{
+		sum += sumLeaves(t, c);
+	}
+	return sum;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAFlatTree_shape)
+{
+	GAFlatTree<int> t(10);
+	int a = t.insert(11, 0);
+	t.insert(13, a);
+	t.insert(14, a);
+	int b = t.insert(12, 0);
+	t.insert(15, b);
+	// 10 (11 (13 14) 12 (15))
+	BOOST_CHECK_EQUAL(t.size(), 6);
+	BOOST_CHECK_EQUAL(t.depth(), 3);
+	BOOST_CHECK_EQUAL(t.extent(0), 6u);
+	BOOST_CHECK_EQUAL(t.extent(1), 3u);
+	BOOST_CHECK_EQUAL(t[4], 12);
+	BOOST_CHECK_EQUAL(t.parent(5), 4);
+	BOOST_CHECK_EQUAL(t.parent(3), 1);
+	BOOST_CHECK_EQUAL(t.parent(0), -1);
+	BOOST_CHECK_EQUAL(t.nchildren(0), 2);
+	BOOST_CHECK_EQUAL(t.nchildren(1), 2);
+	BOOST_CHECK_EQUAL(sumLeaves(t, 0), 13 + 14 + 15);
+	BOOST_CHECK(t.ancestral(1, 3));
+	BOOST_CHECK(!t.ancestral(1, 5));
+
+	// 10 (12 (15) 11 (13 14))
+	BOOST_CHECK_EQUAL(t.swaptree(1, 4), GAFlatTree<int>::NO_ERR);
+	BOOST_CHECK_EQUAL(t[1], 12);
+	BOOST_CHECK_EQUAL(t[3], 11);
+	BOOST_CHECK_EQUAL(t.extent(3), 3u);
+	BOOST_CHECK_EQUAL(t.parent(5), 3);
+
+	// 10 (12 (15 (13 14)) 11 (13 14))
+	BOOST_CHECK_EQUAL(t.replace(2, t, 3), GAFlatTree<int>::NO_ERR);
+	BOOST_CHECK_EQUAL(t.size(), 8);
+	BOOST_CHECK_EQUAL(t.extent(0), 8u);
+	BOOST_CHECK_EQUAL(t.extent(1), 4u);
+	BOOST_CHECK_EQUAL(t.level(3), 3u);
+
+	GAFlatTree<int> *sub = t.clone(1);
+	BOOST_CHECK_EQUAL(sub->size(), 4);
+	BOOST_CHECK_EQUAL(sub->level(0), 0u);
+	BOOST_CHECK_EQUAL(sumLeaves(*sub, 0), 13 + 14);
+	delete sub;
+
+	t.destroy(1);
+	BOOST_CHECK_EQUAL(t.size(), 4);
+	BOOST_CHECK_EQUAL(t.extent(0), 4u);
+	t.insert(9);
+	BOOST_CHECK_EQUAL(t.extent(0), 5u);
+	BOOST_CHECK_EQUAL(t.level(4), 3u);
+	t.destroy(0);
+	BOOST_CHECK_EQUAL(t.size(), 0);
+}
+
+// With the same random numbers, the flat tree operators must do exactly what
+// the linked tree operators do.
+BOOST_AUTO_TEST_CASE(GAFlatTreeGenome_operators)
+{
+	GAResetRNG(21);
+	GATreeGenome<int> mom, dad;
+	buildFlatTree(mom, 300);
+	buildFlatTree(dad, 200);
+	GAFlatTreeGenome<int> fmom, fdad;
+	fmom.GAFlatTree<int>::copy(mom);
+	fdad.GAFlatTree<int>::copy(dad);
+	BOOST_CHECK(sameTree(fmom, mom));
+
+	GAGenome::Mutator muts[][2] = {
+		{GATreeGenome<int>::SwapNodeMutator, GAFlatTreeGenome<int>::SwapNodeMutator},
+		{GATreeGenome<int>::SwapSubtreeMutator,
+		 GAFlatTreeGenome<int>::SwapSubtreeMutator},
+		{GATreeGenome<int>::DestructiveMutator,
+		 GAFlatTreeGenome<int>::DestructiveMutator}};
+	for (auto &m : muts)
+	{
+		for (float pmut : {0.001f, 0.05f})
+		{
+			GATreeGenome<int> t(mom);
+			GAFlatTreeGenome<int> f(fmom);
+			GAResetRNG(7);
+			int n = (*m[0])(t, pmut);
+			GAResetRNG(7);
+			BOOST_CHECK_EQUAL((*m[1])(f, pmut), n);
+			BOOST_CHECK(sameTree(f, t));
+		}
+	}
+
+	for (int i = 0; i < 20; i++)
+	{
+		GATreeGenome<int> sis, bro;
+		GAFlatTreeGenome<int> fsis, fbro;
+		GAResetRNG(100 + i);
+		GATreeGenome<int>::OnePointCrossover(mom, dad, &sis, &bro);
+		GAResetRNG(100 + i);
+		GAFlatTreeGenome<int>::OnePointCrossover(fmom, fdad, &fsis, &fbro);
+		BOOST_CHECK(sameTree(fsis, sis));
+		BOOST_CHECK(sameTree(fbro, bro));
+		BOOST_CHECK_EQUAL(GAFlatTreeGenome<int>::TopologyComparator(fsis, fbro),
+						  GATreeGenome<int>::TopologyComparator(sis, bro));
+
+		GAResetRNG(200 + i);
+		GATreeGenome<int>::OnePointCrossover(mom, dad, &sis, nullptr);
+		GAResetRNG(200 + i);
+		GAFlatTreeGenome<int>::OnePointCrossover(fmom, fdad, &fsis, nullptr);
+		BOOST_CHECK(sameTree(fsis, sis));
+	}
+	BOOST_CHECK_EQUAL(GAFlatTreeGenome<int>::TopologyComparator(fmom, fdad),
+					  GATreeGenome<int>::TopologyComparator(mom, dad));
+	BOOST_CHECK(fmom.equal(fmom));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GAList.hpp>
+#include <GATree.hpp>
+
+#include <GANodePool.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+#if defined(GALIB_USE_NODE_POOL)
+BOOST_AUTO_TEST_CASE(GANodePool_reuse)
+{
+	// A node that is freed is the next one to be handed out.
+	auto *a = new GANode<int>(1);
+	delete a;
+	auto *b = new GANode<int>(2);
+	BOOST_CHECK_EQUAL(static_cast<void *>(a), static_cast<void *>(b));
+	BOOST_CHECK_EQUAL(b->contents, 2);
+	delete b;
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(GANodePool_list)
+{
+	GAList<int> list;
+	for (int i = 0; i < 1000; i++)
+	{
+		list.insert(i);
+	}
+	GAList<int> *copy = list.clone();
+	BOOST_CHECK_EQUAL(copy->size(), 1000);
+	for (int i = 0; i < 1000; i++)
+	{
+		BOOST_CHECK_EQUAL(*copy->warp(i), i);
+	}
+
+	// Nodes move from one list to the other and are freed by their new owner.
+	copy->head();
+	list.tail();
+	list.insert(copy);
+	delete copy;
+	BOOST_CHECK_EQUAL(list.size(), 2000);
+	list.head();
+	while (list.current() != nullptr)
+	{
+		list.destroy();
+	}
+	BOOST_CHECK_EQUAL(list.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GANodePool_threads)
+{
+	// Nodes that are allocated by one thread can be freed by another, and the
+	// free nodes of a thread that exits go back to the pool.
+	auto *tree = new GATree<int>(0);
+	std::thread worker([tree]() {
+		for (int i = 1; i < 500; i++)
+		{
+			tree->insert(i, GATreeBASE::BELOW);
+		}
+		GATree<int> *copy = tree->clone();
+		delete copy;
+	});
+	worker.join();
+	BOOST_CHECK_EQUAL(tree->size(), 500);
+
+	GATree<int> copy(*tree);
+	delete tree;
+	BOOST_CHECK_EQUAL(copy.size(), 500);
+	BOOST_CHECK_EQUAL(*copy.root(), 0);
+}
+
+// A pool of its own, so that nothing else in the tests uses its slabs.
+using GATestPool = GANodePool<1000, 8>;
+
+BOOST_AUTO_TEST_CASE(GANodePool_freeOnly)
+{
+	// A thread that frees nodes but never allocates any still hands them back
+	// when it exits.
+	const int n = 1000;
+	std::vector<void *> nodes(n);
+	std::thread([&]() {
+		for (void *&p : nodes)
+			p = GATestPool::allocate();
+	}).join();
+	std::size_t before = GATestPool::nSlabs();
+	std::thread([&]() {
+		for (void *p : nodes)
+			GATestPool::deallocate(p);
+	}).join();
+	std::thread([&]() {
+		for (void *&p : nodes)
+			p = GATestPool::allocate();
+		for (void *p : nodes)
+			GATestPool::deallocate(p);
+	}).join();
+	BOOST_CHECK_EQUAL(GATestPool::nSlabs(), before);
+}
+
+BOOST_AUTO_TEST_CASE(GANodePool_producerConsumer)
+{
+	// One thread allocates and another frees.  The nodes that are freed come
+	// back round, so the pool does not keep growing.
+	const int n = 500;
+	std::vector<void *> nodes;
+	std::mutex lock;
+	std::condition_variable ready;
+	bool full = false, done = false;
+	std::thread consumer([&]() {
+		std::unique_lock<std::mutex> guard(lock);
+		while (!done)
+		{
+			ready.wait(guard, [&]() { return full || done; });
+			for (void *p : nodes)
+				GATestPool::deallocate(p);
+			nodes.clear();
+			full = false;
+			ready.notify_all();
+		}
+	});
+
+	std::size_t before = GATestPool::nSlabs();
+	for (int round = 0; round < 200; round++)
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		for (int i = 0; i < n; i++)
+			nodes.push_back(GATestPool::allocate());
+		full = true;
+		ready.notify_all();
+		ready.wait(guard, [&]() { return !full; });
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		done = true;
+		ready.notify_all();
+	}
+	consumer.join();
+	// The nodes in use, plus what each thread may keep, plus a slab or two
+	// on the way between them (a slab holds 65 of these nodes).
+	BOOST_CHECK_LE(GATestPool::nSlabs() - before, std::size_t(n / 65 + 8));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
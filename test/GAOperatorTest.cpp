@@ -0,0 +1,605 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#define INSTANTIATE_REAL_GENOME
+#include <GARealGenome.h>
+#include <GARealESGenome.h>
+#define INSTANTIATE_STRING_GENOME
+#include <GAStringGenome.h>
+#include <GASimpleGA.h>
+#include <GASStateGA.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+static float objectiveOperatorOnes(GAGenome &g)
+{
+	auto &genome = static_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+static float objectiveOperatorSphere(GAGenome &g)
+{
+	auto &genome = static_cast<GARealGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i) * genome.gene(i);
+	}
+	return score;
+}
+
+static float deltaOperatorSphere(GAGenome &g, float score,
+								 const unsigned int *changed, int nchanged)
+{
+	auto &genome = static_cast<GARealGenome &>(g);
+	for (int k = 0; k < nchanged; k++)
+	{
+		float was = genome.previous(changed[k]), now = genome.gene(changed[k]);
+		score += now * now - was * was;
+	}
+	return score;
+}
+
+// Same as the library operators, but unknown to the genome.
+static int userFlipMutator(GAGenome &g, float p)
+{
+	return GA1DBinaryStringGenome::FlipMutator(g, p);
+}
+
+static int userUniformCrossover(const GAGenome &a, const GAGenome &b,
+								GAGenome *c1, GAGenome *c2)
+{
+	return GA1DBinaryStringGenome::UniformCrossover(a, b, c1, c2);
+}
+
+static int userBlendCrossover(const GAGenome &a, const GAGenome &b,
+							  GAGenome *c1, GAGenome *c2)
+{
+	return GARealBlendCrossover(a, b, c1, c2);
+}
+
+static int userGaussianMutator(GAGenome &g, float p)
+{
+	return GARealGaussianMutator(g, p);
+}
+
+// Run a few generations and record the best score of each one.
+static std::vector<float> runOperators(GAGeneticAlgorithm &ga, int ngen)
+{
+	std::vector<float> best;
+	GAResetRNG(11);
+	ga.initialize();
+	for (int i = 0; i < ngen; i++)
+	{
+		ga.step();
+		best.push_back(ga.population().best().score());
+	}
+	return best;
+}
+
+// The same random tour in an integer genome and a double genome.  The
+// permutation crossovers look up the integers and search for the doubles.
+static void randomTour(GA1DArrayGenome<int> &g, GA1DArrayGenome<double> &d)
+{
+	for (int i = 0; i < g.length(); i++)
+	{
+		g.gene(i, i);
+	}
+	for (int i = g.length() - 1; i > 0; i--)
+	{
+		g.swap(i, GARandomInt(0, i));
+	}
+	for (int i = 0; i < g.length(); i++)
+	{
+		d.gene(i, g.gene(i));
+	}
+}
+
+static bool sameGenes(const GA1DArrayGenome<int> &g, const GA1DArrayGenome<double> &d)
+{
+	for (int i = 0; i < g.length(); i++)
+	{
+		if (g.gene(i) != d.gene(i))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool isTour(const GA1DArrayGenome<int> &g)
+{
+	std::vector<bool> seen(g.length(), false);
+	for (int i = 0; i < g.length(); i++)
+	{
+		if (g.gene(i) < 0 || g.gene(i) >= g.length() || seen[g.gene(i)])
+		{
+			return false;
+		}
+		seen[g.gene(i)] = true;
+	}
+	return true;
+}
+
+// A sphere whose elements have ranges from 1e-6 to 1e4.  Each element is
+// measured against its range, so they all count the same.
+static const int BADLY_SCALED = 8;
+
+static float badlyScaledRange(int i)
+{
+	return std::pow(10.0F, -6.0F + 10.0F * i / (BADLY_SCALED - 1));
+}
+
+static float objectiveBadlyScaled(GAGenome &g)
+{
+	auto &genome = static_cast<GARealGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		float x = genome.gene(i) / badlyScaledRange(i);
+		score += x * x;
+	}
+	return score;
+}
+
+// How many evaluations a steady-state GA needs to get below the target (or
+// all the ones it made if it gives up first), and the best score it got.
+static unsigned long evaluationsToTarget(const GAGenome &g, float target,
+										 int ngen, float &best)
+{
+	GASteadyStateGA ga(g);
+	ga.minimize();
+	ga.selector(GATournamentSelector());
+	ga.populationSize(30);
+	ga.pCrossover(0.9);
+	ga.pMutation(0.1);
+	GAResetRNG(31);
+	ga.initialize();
+	while (ga.statistics().generation() < ngen &&
+		   ga.population().best().score() > target)
+	{
+		ga.step();
+	}
+	best = ga.population().best().score();
+	return ga.statistics().indEvals();
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAGenome_uncheckedOperators)
+{
+	GA1DBinaryStringGenome bin(16);
+	BOOST_CHECK(bin.uncheckedMutator(GA1DBinaryStringGenome::FlipMutator) != nullptr);
+	BOOST_CHECK(bin.uncheckedCrossover(GA1DBinaryStringGenome::TwoPointCrossover) != nullptr);
+	BOOST_CHECK(bin.uncheckedMutator(userFlipMutator) == nullptr);
+	BOOST_CHECK(bin.uncheckedCrossover(userUniformCrossover) == nullptr);
+
+	GARealAlleleSet alleles(-1.0, 1.0);
+	GARealGenome real(8, alleles);
+	BOOST_CHECK(real.uncheckedMutator(GARealGaussianMutator) != nullptr);
+	BOOST_CHECK(real.uncheckedMutator(GARealSwapMutator) != nullptr);
+	BOOST_CHECK(real.uncheckedCrossover(GARealBlendCrossover) != nullptr);
+	BOOST_CHECK(real.uncheckedCrossover(GARealPartialMatchCrossover) != nullptr);
+	BOOST_CHECK(real.uncheckedCrossover(userBlendCrossover) == nullptr);
+
+	// The unchecked operators do the same thing as the checked ones.
+	GA1DBinaryStringGenome mom(16), dad(16), c1(16), c2(16), d1(16), d2(16);
+	mom.set(0, 8);
+	dad.set(8, 8);
+	GAResetRNG(3);
+	GA1DBinaryStringGenome::UniformCrossover(mom, dad, &c1, &c2);
+	GAResetRNG(3);
+	(*bin.uncheckedCrossover(GA1DBinaryStringGenome::UniformCrossover))(mom, dad, &d1, &d2);
+	BOOST_CHECK(c1 == d1);
+	BOOST_CHECK(c2 == d2);
+}
+
+// The genetic algorithms must do the same runs whether or not they find the
+// unchecked versions of the operators.
+BOOST_AUTO_TEST_CASE(GAGeneticAlgorithm_uncheckedOperators)
+{
+	GA1DBinaryStringGenome known(48, objectiveOperatorOnes);
+	known.crossover(GA1DBinaryStringGenome::UniformCrossover);
+	GA1DBinaryStringGenome unknown(48, objectiveOperatorOnes);
+	unknown.crossover(userUniformCrossover);
+	unknown.mutator(userFlipMutator);
+
+	GASimpleGA fast(known), slow(unknown);
+	GASteadyStateGA sfast(known), sslow(unknown);
+	for (GAGeneticAlgorithm *ga : {(GAGeneticAlgorithm *)&fast, (GAGeneticAlgorithm *)&slow,
+								   (GAGeneticAlgorithm *)&sfast, (GAGeneticAlgorithm *)&sslow})
+	{
+		ga->populationSize(30);
+		ga->pMutation(0.02);
+	}
+	BOOST_CHECK(runOperators(fast, 20) == runOperators(slow, 20));
+	BOOST_CHECK(runOperators(sfast, 20) == runOperators(sslow, 20));
+	BOOST_CHECK_EQUAL(fast.statistics().mutations(), slow.statistics().mutations());
+
+	GARealAlleleSet alleles(-5.0, 5.0);
+	GARealGenome real(6, alleles, objectiveOperatorSphere);
+	real.crossover(GARealBlendCrossover);
+	GARealGenome user(6, alleles, objectiveOperatorSphere);
+	user.crossover(userBlendCrossover);
+	user.mutator(userGaussianMutator);
+
+	GASimpleGA rfast(real), rslow(user);
+	rfast.minimize();
+	rslow.minimize();
+	BOOST_CHECK(runOperators(rfast, 20) == runOperators(rslow, 20));
+}
+
+// With the same random numbers, the permutation crossovers must make the same
+// children whether they look the elements up or search for them.
+BOOST_AUTO_TEST_CASE(GA1DArrayGenome_permutationCrossovers)
+{
+	GAResetRNG(5);
+	const int n = 40;
+	GA1DArrayGenome<int> mom(n), dad(n), sis(n), bro(n);
+	GA1DArrayGenome<double> dmom(n), ddad(n), dsis(n), dbro(n);
+	randomTour(mom, dmom);
+	randomTour(dad, ddad);
+
+	GAGenome::SexualCrossover cross[][2] = {
+		{GA1DArrayGenome<int>::PartialMatchCrossover,
+		 GA1DArrayGenome<double>::PartialMatchCrossover},
+		{GA1DArrayGenome<int>::OrderCrossover, GA1DArrayGenome<double>::OrderCrossover},
+		{GA1DArrayGenome<int>::CycleCrossover, GA1DArrayGenome<double>::CycleCrossover}};
+	for (auto &c : cross)
+	{
+		for (int i = 0; i < 30; i++)
+		{
+			GAResetRNG(400 + i);
+			(*c[0])(mom, dad, &sis, &bro);
+			GAResetRNG(400 + i);
+			(*c[1])(dmom, ddad, &dsis, &dbro);
+			BOOST_CHECK(sameGenes(sis, dsis));
+			BOOST_CHECK(sameGenes(bro, dbro));
+			BOOST_CHECK(isTour(sis));
+			BOOST_CHECK(isTour(bro));
+
+			GAResetRNG(500 + i);
+			(*c[0])(mom, dad, &sis, nullptr);
+			GAResetRNG(500 + i);
+			(*c[1])(dmom, ddad, &dsis, nullptr);
+			BOOST_CHECK(sameGenes(sis, dsis));
+		}
+	}
+
+	// When the father is not a permutation of the mother the lookup gives up
+	// where the search gives up.
+	dad.gene(3, n + 7);
+	ddad.gene(3, n + 7);
+	dad.gene(11, dad.gene(12));
+	ddad.gene(11, ddad.gene(12));
+	for (auto &c : cross)
+	{
+		for (int i = 0; i < 30; i++)
+		{
+			GAResetRNG(600 + i);
+			(*c[0])(mom, dad, &sis, &bro);
+			GAResetRNG(600 + i);
+			(*c[1])(dmom, ddad, &dsis, &dbro);
+			BOOST_CHECK(sameGenes(sis, dsis));
+			BOOST_CHECK(sameGenes(bro, dbro));
+		}
+	}
+}
+
+// The real operators write whole blocks of elements when they can.  They must
+// give the same children as they do element by element.
+BOOST_AUTO_TEST_CASE(GARealGenome_blockOperators)
+{
+	// The Gaussian numbers come out the same one at a time or all at once,
+	// whether or not there is a twin waiting.
+	for (int n : {1, 6, 7, 130})
+	{
+		std::vector<float> one, all(n);
+		GAResetRNG(9);
+		GAUnitGaussian();
+		for (int i = 0; i < n; i++)
+			one.push_back(static_cast<float>(GAUnitGaussian()));
+		float next = static_cast<float>(GAUnitGaussian());
+		GAResetRNG(9);
+		GAUnitGaussian();
+		GAUnitGaussians(all.data(), n);
+		BOOST_CHECK(one == all);
+		BOOST_CHECK_EQUAL(static_cast<float>(GAUnitGaussian()), next);
+	}
+
+	const int len = 150;
+	GARealAlleleSet alleles(-1.0, 1.0);
+	GARealGenome mom(len, alleles), dad(len, alleles);
+	GAResetRNG(21);
+	mom.initialize();
+	dad.initialize();
+
+	// Gaussian mutation, against adding the numbers one at a time in double.
+	GARealGenome mutant(mom), expected(mom);
+	GAResetRNG(6);
+	int nmut = GARealGaussianMutator(mutant, 0.5);
+	BOOST_CHECK_EQUAL(nmut, len / 2);
+	GAResetRNG(6);
+	for (int done = 0; done < nmut; done += 64)
+	{
+		int k = std::min(64, nmut - done);
+		std::vector<int> index;
+		for (int j = 0; j < k; j++)
+			index.push_back(GARandomInt(0, len - 1));
+		for (int i : index)
+		{
+			float value = expected.gene(i);
+			value += GAUnitGaussian();
+			expected.gene(i, std::min(1.0F, std::max(-1.0F, value)));
+		}
+	}
+	BOOST_CHECK(mutant == expected);
+
+	// Blend, against the element-by-element version.
+	GARealGenome sis(len, alleles), bro(len, alleles), only(len, alleles);
+	GAResetRNG(4);
+	BOOST_CHECK_EQUAL(GARealBlendCrossover(mom, dad, &sis, &bro), 2);
+	BOOST_CHECK_EQUAL(GARealBlendCrossover(mom, dad, nullptr, &only), 1);
+	GAResetRNG(4);
+	for (int i = 0; i < len; i++)
+	{
+		float dist = std::fabs(mom.gene(i) - dad.gene(i));
+		float lo = GAMin(mom.gene(i), dad.gene(i)) - float(0.5) * dist;
+		float hi = GAMax(mom.gene(i), dad.gene(i)) + float(0.5) * dist;
+		BOOST_CHECK_EQUAL(sis.gene(i), GARandomFloat(lo, hi));
+		BOOST_CHECK_EQUAL(bro.gene(i), GARandomFloat(lo, hi));
+	}
+	for (int i = 0; i < len; i++)
+	{
+		float dist = std::fabs(mom.gene(i) - dad.gene(i));
+		float lo = GAMin(mom.gene(i), dad.gene(i)) - float(0.5) * dist;
+		float hi = GAMax(mom.gene(i), dad.gene(i)) + float(0.5) * dist;
+		BOOST_CHECK_EQUAL(only.gene(i), GARandomFloat(lo, hi));
+	}
+
+	// Arithmetic, into a child that logs its changes and one that does not.
+	GARealGenome logged(len, alleles, objectiveOperatorSphere);
+	logged.deltaEvaluator(deltaOperatorSphere);
+	logged.evaluate();
+	BOOST_REQUIRE(logged.logsChanges());
+	BOOST_CHECK_EQUAL(GARealArithmeticCrossover(mom, dad, &sis, &logged), 2);
+	for (int i = 0; i < len; i++)
+	{
+		BOOST_CHECK_EQUAL(sis.gene(i), float(0.5) * (mom.gene(i) + dad.gene(i)));
+		BOOST_CHECK_EQUAL(logged.gene(i), sis.gene(i));
+	}
+	BOOST_CHECK(!sis.isEvaluated());
+
+	// A few mutations are the same with one set or a set for each element.
+	// Lots of them stay in bounds and are all counted.
+	GARealAlleleSetArray each;
+	for (int i = 0; i < len; i++)
+		each.add(alleles);
+	GARealGenome fast(mom), slow(each);
+	for (int i = 0; i < len; i++)
+		slow.gene(i, mom.gene(i));
+	GAResetRNG(13);
+	int nfast = GARealGaussianMutator(fast, 0.004);
+	GAResetRNG(13);
+	int nslow = GARealGaussianMutator(slow, 0.004);
+	BOOST_CHECK_EQUAL(nfast, nslow);
+	for (int i = 0; i < len; i++)
+		BOOST_CHECK_EQUAL(fast.gene(i), slow.gene(i));
+
+	fast.copy(mom);
+	BOOST_CHECK_EQUAL(GARealGaussianMutator(fast, 0.5), len / 2);
+	int nchanged = 0;
+	for (int i = 0; i < len; i++)
+	{
+		BOOST_CHECK(fast.gene(i) >= -1.0 && fast.gene(i) <= 1.0);
+		nchanged += (fast.gene(i) != mom.gene(i) ? 1 : 0);
+	}
+	BOOST_CHECK_GT(nchanged, len / 4);
+}
+
+// The allele table gives the same alleles as the allele sets, from the same
+// random numbers, and the copies of a genome share it.
+BOOST_AUTO_TEST_CASE(GAAlleleTable_lookups)
+{
+	GARealAlleleSetArray sets;
+	float some[] = {1, 2, 3};
+	sets.add(3, some);
+	sets.add(-1, 1);
+	sets.add(0, 1, 0.25);
+	sets.add(0, 1, GAAllele::BoundType::EXCLUSIVE, GAAllele::BoundType::EXCLUSIVE);
+	GARealGenome genome(sets);
+	const GAAlleleTable<float> &alleles = genome.alleles();
+	BOOST_CHECK_EQUAL(alleles.size(), 4);
+	BOOST_CHECK(!alleles.all(GAAllele::Type::BOUNDED));
+	for (int i = 0; i < 8; i++)
+	{
+		const GARealAlleleSet &set = genome.alleleset(i);
+		BOOST_CHECK(alleles.type(i) == set.type());
+		if (set.type() != GAAllele::Type::ENUMERATED)
+		{
+			BOOST_CHECK_EQUAL(alleles.lower(i), set.lower());
+			BOOST_CHECK_EQUAL(alleles.upper(i), set.upper());
+			BOOST_CHECK(alleles.lowerBoundType(i) == set.lowerBoundType());
+		}
+	}
+	BOOST_CHECK_EQUAL(alleles.inc(6), float(0.25));
+
+	std::vector<float> fromSets, fromTable;
+	GAResetRNG(17);
+	for (int i = 0; i < 400; i++)
+		fromSets.push_back(genome.alleleset(i).allele());
+	GAResetRNG(17);
+	for (int i = 0; i < 400; i++)
+		fromTable.push_back(alleles.random(i));
+	BOOST_CHECK(fromSets == fromTable);
+
+	GARealGenome copy(genome);
+	std::unique_ptr<GAGenome> clone(genome.clone());
+	BOOST_CHECK(&copy.alleles() == &alleles);
+	BOOST_CHECK(&static_cast<GARealGenome &>(*clone).alleles() == &alleles);
+
+	// A genome of another type, through its initializer and mutator.
+	int digits[] = {3, 5, 7, 9};
+	GAAlleleSet<int> odd(4, digits);
+	GA1DArrayAlleleGenome<int> ints(200, odd);
+	GAResetRNG(2);
+	ints.initialize();
+	BOOST_CHECK_GT(GA1DArrayAlleleGenome<int>::FlipMutator(ints, 0.3), 0);
+	for (int i = 0; i < ints.length(); i++)
+		BOOST_CHECK(ints.gene(i) % 2 == 1 && ints.gene(i) >= 3 && ints.gene(i) <= 9);
+	BOOST_CHECK(ints.alleles().all(GAAllele::Type::ENUMERATED));
+
+	// Element by element (with a change log) or straight into the array, the
+	// Gaussian mutator makes the same changes.
+	GARealAlleleSet bounds(-1.0, 1.0);
+	GARealGenome plain(60, bounds, objectiveOperatorSphere);
+	GAResetRNG(23);
+	plain.initialize();
+	GARealGenome logging(plain);
+	logging.deltaEvaluator(deltaOperatorSphere);
+	logging.evaluate();
+	BOOST_REQUIRE(logging.logsChanges());
+	GAResetRNG(8);
+	int nplain = GARealGaussianMutator(plain, 0.01);
+	GAResetRNG(8);
+	int nlogging = GARealGaussianMutator(logging, 0.01);
+	BOOST_CHECK_EQUAL(nplain, nlogging);
+	BOOST_CHECK(plain == logging);
+	BOOST_CHECK_CLOSE(logging.score(), objectiveOperatorSphere(logging), 0.001);
+}
+
+// The string genome builds its allele table too, so its default initializer
+// and mutator and a resize pick letters from its sets.
+BOOST_AUTO_TEST_CASE(GAStringGenome_alleles)
+{
+	char letters[] = {'a', 'c', 'g', 't'};
+	GAStringAlleleSet bases(4, letters);
+	auto isBase = [](char c) { return c == 'a' || c == 'c' || c == 'g' || c == 't'; };
+
+	GAStringGenome genome(10, bases, objectiveOperatorOnes);
+	BOOST_CHECK_EQUAL(genome.className(), "GAStringGenome");
+	BOOST_CHECK(genome.alleles().all(GAAllele::Type::ENUMERATED));
+	GAResetRNG(6);
+	genome.initialize();
+	BOOST_CHECK_GT(genome.mutate(0.5), 0);
+	BOOST_CHECK_EQUAL(genome.resize(25), 25);
+	for (int i = 0; i < genome.length(); i++)
+		BOOST_CHECK(isBase(genome.gene(i)));
+
+	std::unique_ptr<GAGenome> clone(genome.clone());
+	BOOST_CHECK(&static_cast<GAStringGenome &>(*clone).alleles() == &genome.alleles());
+	BOOST_CHECK(*clone == genome);
+
+	char digits[] = {'0', '1'};
+	GAStringAlleleSetArray sets;
+	sets.add(bases);
+	sets.add(2, digits);
+	GAStringGenome mixed(sets);
+	mixed.initialize();
+	BOOST_CHECK_EQUAL(mixed.length(), 2);
+	BOOST_CHECK(isBase(mixed.gene(0)));
+	BOOST_CHECK(mixed.gene(1) == '0' || mixed.gene(1) == '1');
+}
+
+// The step sizes go with the genome and through the discrete crossover, and
+// the mutator keeps them (and the elements) in their ranges.
+BOOST_AUTO_TEST_CASE(GARealESGenome_steps)
+{
+	GARealAlleleSetArray sets;
+	sets.add(-1, 1);
+	sets.add(0, 1000);
+	float some[] = {1, 2, 3};
+	sets.add(3, some);
+	GARealESGenome mom(sets), dad(sets);
+	BOOST_CHECK_EQUAL(mom.range(1), 1000.0F);
+	BOOST_CHECK_EQUAL(mom.range(2), 1.0F);
+	BOOST_CHECK_EQUAL(mom.step(1), 100.0F);
+
+	GAResetRNG(3);
+	mom.initialize();
+	dad.initialize();
+	for (int i = 0; i < 3; i++)
+		dad.step(i, 4 * mom.step(i));
+	BOOST_CHECK_CLOSE(dad.step(0), 0.8F, 0.001);
+
+	GARealESGenome copy(dad), assigned(sets);
+	assigned = dad;
+	std::unique_ptr<GAGenome> clone(dad.clone());
+	auto &cloned = static_cast<GARealESGenome &>(*clone);
+	for (int i = 0; i < 3; i++)
+	{
+		BOOST_CHECK_EQUAL(copy.step(i), dad.step(i));
+		BOOST_CHECK_EQUAL(assigned.step(i), dad.step(i));
+		BOOST_CHECK_EQUAL(cloned.step(i), dad.step(i));
+	}
+	BOOST_CHECK(cloned == dad);
+
+	GARealESGenome sis(sets), bro(sets);
+	BOOST_CHECK_EQUAL(GARealESGenome::DiscreteCrossover(mom, dad, &sis, &bro), 2);
+	for (int i = 0; i < 3; i++)
+	{
+		BOOST_CHECK_CLOSE(sis.step(i), 2.5F * mom.step(i), 0.001);
+		BOOST_CHECK_EQUAL(bro.step(i), sis.step(i));
+		BOOST_CHECK(sis.gene(i) == mom.gene(i) || sis.gene(i) == dad.gene(i));
+		BOOST_CHECK_EQUAL(sis.gene(i) + bro.gene(i), mom.gene(i) + dad.gene(i));
+	}
+
+	// Lots of mutations push the step sizes against both of their limits.
+	GARealAlleleSet bounds(-1.0, 1.0);
+	GARealESGenome walker(50, bounds);
+	walker.minimumStep(0.01);
+	GAResetRNG(5);
+	walker.initialize();
+	bool changed = false;
+	for (int n = 0; n < 400; n++)
+	{
+		BOOST_CHECK_EQUAL(GARealESGenome::SelfAdaptiveMutator(walker, 0.1), 50);
+		changed = changed || walker.step(0) != 0.2F;
+	}
+	BOOST_CHECK(changed);
+	for (int i = 0; i < walker.length(); i++)
+	{
+		BOOST_CHECK(walker.gene(i) >= -1.0 && walker.gene(i) <= 1.0);
+		BOOST_CHECK(walker.step(i) >= 0.02F * 0.999F && walker.step(i) <= 2.0F);
+	}
+	BOOST_CHECK_EQUAL(GARealESGenome::SelfAdaptiveMutator(walker, 0.0), 0);
+
+	// A longer genome gets the initial steps for its new elements.
+	walker.resize(60);
+	BOOST_CHECK_CLOSE(walker.step(59), 0.2F, 0.001);
+	walker.copy(mom);
+	BOOST_CHECK_EQUAL(walker.length(), 3);
+	BOOST_CHECK_EQUAL(walker.step(1), mom.step(1));
+}
+
+// On a badly scaled problem the step sizes find their scales and the GA gets
+// to the target several times sooner than with the Gaussian mutator, which
+// does not get there at all.
+BOOST_AUTO_TEST_CASE(GARealESGenome_badlyScaled)
+{
+	GARealAlleleSetArray sets;
+	for (int i = 0; i < BADLY_SCALED; i++)
+		sets.add(-badlyScaledRange(i), badlyScaledRange(i));
+	GARealGenome plain(sets, objectiveBadlyScaled);
+	GARealESGenome es(sets, objectiveBadlyScaled);
+
+	const float target = 1.0e-4F;
+	const int ngen = 600;
+	float bplain, bes;
+	unsigned long nplain = evaluationsToTarget(plain, target, ngen, bplain);
+	unsigned long nes = evaluationsToTarget(es, target, ngen, bes);
+	BOOST_TEST_MESSAGE("evaluations: " << nplain << " plain, " << nes << " es");
+	BOOST_CHECK_GT(bplain, target);
+	BOOST_CHECK_LE(bes, target);
+	BOOST_CHECK_LT(3 * nes, nplain);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,204 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAParameter.h>
+#include <GASimpleGA.h>
+#include <GASStateGA.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+static float parameterObjective(GAGenome &)
+{
+	return 0;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAParameterList_find)
+{
+	GAParameterList params;
+	GASteadyStateGA::registerDefaultParameters(params);
+	BOOST_REQUIRE(params.find(gaNpMutation) != nullptr);
+	BOOST_CHECK(params.find(gaNpMutation) == params.find(gaSNpMutation));
+	BOOST_CHECK(params.find("no_such_parameter") == nullptr);
+
+	// A copy has its own parameters.
+	GAParameterList copy(params);
+	BOOST_CHECK(copy.find(gaNpMutation) != params.find(gaNpMutation));
+	BOOST_REQUIRE(copy.set(gaSNpMutation, 0.25));
+	float value = 0;
+	BOOST_REQUIRE(params.get(gaNpMutation, &value));
+	BOOST_CHECK_NE(value, 0.25f);
+	BOOST_REQUIRE(copy.get(gaNpMutation, &value));
+	BOOST_CHECK_EQUAL(value, 0.25f);
+
+	// Parameters added later are found too.
+	int extra = 7;
+	BOOST_REQUIRE(copy.add("extra_parameter", "extra", ParType::INT, &extra));
+	BOOST_CHECK(copy.find("extra") == &copy.back());
+
+	// A list of the same size that is assigned another finds the new names.
+	GAParameterList other;
+	other.add("other_parameter", "other", ParType::INT, &extra);
+	GAParameterList one;
+	one.add("one_parameter", "one", ParType::INT, &extra);
+	other = one;
+	BOOST_CHECK(other.find("other") == nullptr);
+	BOOST_CHECK(other.find("one") == &other.front());
+}
+
+// Assigning a list (which is what copying a GA does) keeps the handles good.
+BOOST_AUTO_TEST_CASE(GAParameterList_assignKeepsHandles)
+{
+	GAParameterList params, other;
+	GASteadyStateGA::registerDefaultParameters(params);
+	GASimpleGA::registerDefaultParameters(other);
+	int extra = 3;
+	params.add("extra_parameter", "extra", ParType::INT, &extra);
+	BOOST_REQUIRE(other.set(gaNpMutation, 0.25));
+
+	GAParameterHandle<float> pmut = params.handle<float>(gaNpMutation);
+	const GAParameter *where = &pmut.parameter();
+	params = other;
+	BOOST_CHECK(params.find(gaNpMutation) == where);
+	BOOST_CHECK_EQUAL(pmut.get(), 0.25f);
+	BOOST_CHECK(params.find("extra") == nullptr);
+	BOOST_CHECK_EQUAL(params.size(), other.size());
+	auto a = params.begin();
+	for (const GAParameter &p : other)
+	{
+		BOOST_CHECK_EQUAL(a->fullname(), p.fullname());
+		++a;
+	}
+
+	// So does copying a GA.
+	GA1DBinaryStringGenome genome(8, parameterObjective);
+	GASimpleGA ga(genome), from(genome);
+	GAParameterHandle<float> handle = ga.parameter<float>(gaNpMutation);
+	from.pMutation(0.375);
+	ga.copy(from);
+	BOOST_REQUIRE(handle.valid());
+	BOOST_CHECK_EQUAL(handle.get(), 0.375f);
+	BOOST_CHECK(ga.parameters().find(gaNpMutation) == &handle.parameter());
+}
+
+BOOST_AUTO_TEST_CASE(GAParameterList_handles)
+{
+	GAParameterList params;
+	GASteadyStateGA::registerDefaultParameters(params);
+
+	GAParameterHandle<float> pmut = params.handle<float>(gaNpMutation);
+	GAParameterHandle<int> ngen = params.handle<int>(gaSNnGenerations);
+	GAParameterHandle<int> timing = params.handle<int>(gaNrecordTiming);
+	BOOST_REQUIRE(pmut.valid());
+	BOOST_REQUIRE(ngen.valid());
+	BOOST_REQUIRE(timing.valid());
+	BOOST_CHECK(!params.handle<double>(gaNpMutation).valid());
+	BOOST_CHECK(!params.handle<int>("no_such_parameter").valid());
+
+	std::vector<std::string> changed;
+	int id = params.listen([&](const GAParameter &p)
+						   { changed.push_back(p.fullname()); });
+	pmut.set(0.125);
+	ngen.set(ngen.get() + 1);
+	ngen.set(ngen.get()); // not a change
+	timing.set(1);
+	params.set(gaSNpCrossover, 0.5);
+	BOOST_CHECK_EQUAL(pmut.get(), 0.125f);
+	BOOST_CHECK_EQUAL(timing.get(), 1);
+	BOOST_REQUIRE_EQUAL(changed.size(), 4u);
+	BOOST_CHECK_EQUAL(changed[0], gaNpMutation);
+	BOOST_CHECK_EQUAL(changed[1], gaNnGenerations);
+	BOOST_CHECK_EQUAL(changed[2], gaNrecordTiming);
+	BOOST_CHECK_EQUAL(changed[3], gaNpCrossover);
+
+	params.ignore(id);
+	pmut.set(0.5);
+	BOOST_CHECK_EQUAL(changed.size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(GAParameterList_binary)
+{
+	GAParameterList params;
+	GASteadyStateGA::registerDefaultParameters(params);
+	params.set(gaNpMutation, 0.1234567);
+	params.set(gaNnGenerations, 777);
+	params.set(gaNscoreFilename, "scores.dat");
+	params.set(gaNrecordDiversity, 1);
+
+	std::stringstream out;
+	BOOST_REQUIRE(params.writeBinary(out));
+	std::stringstream text;
+	params.write(text);
+	BOOST_CHECK_LT(out.str().size(), text.str().size() * 2);
+
+	GAParameterList other;
+	GASteadyStateGA::registerDefaultParameters(other);
+	int nchanged = 0;
+	other.listen([&](const GAParameter &) { nchanged++; });
+	std::stringstream in(out.str());
+	BOOST_REQUIRE(other.readBinary(in));
+	BOOST_CHECK_EQUAL(nchanged, 4);
+
+	float pmut = 0;
+	int ngen = 0, div = 0;
+	other.get(gaNpMutation, &pmut);
+	other.get(gaNnGenerations, &ngen);
+	other.get(gaNrecordDiversity, &div);
+	BOOST_CHECK_EQUAL(pmut, 0.1234567f);
+	BOOST_CHECK_EQUAL(ngen, 777);
+	BOOST_CHECK_EQUAL(div, 1);
+	BOOST_CHECK_EQUAL(static_cast<const char *>(other.find(gaNscoreFilename)->value()),
+					  std::string("scores.dat"));
+
+	// A list that has fewer parameters takes the ones it has.
+	GAParameterList few;
+	few.add(gaNpMutation, gaSNpMutation, ParType::FLOAT, &pmut);
+	pmut = 0;
+	few.set(gaNpMutation, 0.0);
+	std::stringstream again(out.str());
+	BOOST_REQUIRE(few.readBinary(again));
+	few.get(gaNpMutation, &pmut);
+	BOOST_CHECK_EQUAL(pmut, 0.1234567f);
+
+	GAReportErrors(false);
+	std::string bytes = out.str();
+	std::stringstream truncated(bytes.substr(0, bytes.size() - 3));
+	BOOST_CHECK(!other.readBinary(truncated));
+	std::stringstream garbage("not a parameter list");
+	BOOST_CHECK(!other.readBinary(garbage));
+	GAReportErrors(true);
+}
+
+// A handle on the parameters of a GA sets them in the GA.
+BOOST_AUTO_TEST_CASE(GAGeneticAlgorithm_parameterHandle)
+{
+	GA1DBinaryStringGenome genome(10, parameterObjective);
+	GASimpleGA ga(genome);
+	GAParameterHandle<float> pmut = ga.parameter<float>(gaNpMutation);
+	GAParameterHandle<int> ngen = ga.parameter<int>(gaSNnGenerations);
+	BOOST_REQUIRE(pmut.valid());
+	pmut.set(0.0625);
+	ngen.set(42);
+	BOOST_CHECK_EQUAL(ga.pMutation(), 0.0625f);
+	BOOST_CHECK_EQUAL(ga.nGenerations(), 42);
+
+	ga.pMutation(0.25);
+	BOOST_CHECK_EQUAL(pmut.get(), 0.25f);
+	ga.set(gaSNpCrossover, 0.75);
+	BOOST_CHECK_EQUAL(ga.pCrossover(), 0.75f);
+
+	// A copy of the GA listens to its own parameters.
+	GASimpleGA copy(ga);
+	copy.parameter<int>(gaNnGenerations).set(7);
+	BOOST_CHECK_EQUAL(copy.nGenerations(), 7);
+	BOOST_CHECK_EQUAL(ga.nGenerations(), 42);
+	ga.copy(copy);
+	ga.parameter<int>(gaNnGenerations).set(9);
+	BOOST_CHECK_EQUAL(ga.nGenerations(), 9);
+	BOOST_CHECK_EQUAL(copy.nGenerations(), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
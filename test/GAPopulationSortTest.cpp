@@ -0,0 +1,136 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GAPopulation.h>
+#include <garandom.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// The quicksort the population used before it learned to skip the end of a
+// segment that is already in place.  The order it leaves ties in is part of
+// the seeded results of the examples, so the sort must still match it.
+static void referenceSort(std::vector<GAGenome *> &c, int l, int r, bool ascending)
+{
+	if (r > l)
+	{
+		float v = c[r]->score();
+		int i = l - 1;
+		int j = r;
+		for (;;)
+		{
+			if (ascending)
+			{
+				while (c[++i]->score() < v && i <= r)
+					;
+				while (c[--j]->score() > v && j > 0)
+					;
+			}
+			else
+			{
+				while (c[++i]->score() > v && i <= r)
+					;
+				while (c[--j]->score() < v && j > 0)
+					;
+			}
+			if (i >= j)
+				break;
+			std::swap(c[i], c[j]);
+		}
+		std::swap(c[i], c[r]);
+		referenceSort(c, l, i - 1, ascending);
+		referenceSort(c, i + 1, r, ascending);
+	}
+}
+
+// Scores that look like what a GA sorts:  random ones, ones that are already
+// in order, a sorted population with a few new ones at the end, and lots of
+// ties.
+static std::vector<float> scores(int kind, int n)
+{
+	std::vector<float> s(n);
+	for (int i = 0; i < n; i++)
+		s[i] = GARandomInt(0, (kind % 2) ? 10 : 1000);
+	if (kind >= 2)
+		std::sort(s.begin(), s.end(), [](float a, float b) { return a > b; });
+	if (kind >= 4)
+		for (int i = n - 1 - n / 20; i < n; i++)
+			s[i] = GARandomInt(0, (kind % 2) ? 10 : 1000);
+	if (kind >= 6)
+		std::fill(s.end() - n / 10, s.end(), -1.0f);
+	if (kind == 8)
+		s[n / 2] = std::nanf("");
+	return s;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAPopulation_sortOrder)
+{
+	GAResetRNG(59);
+	GA1DBinaryStringGenome genome(8);
+	for (int n : {2, 7, 100, 1000})
+	{
+		for (int kind = 0; kind <= 8; kind++)
+		{
+			for (auto order : {GAPopulation::HIGH_IS_BEST, GAPopulation::LOW_IS_BEST})
+			{
+				GAPopulation pop(genome, n);
+				pop.order(order);
+				std::vector<float> s = scores(kind, n);
+				if (order == GAPopulation::LOW_IS_BEST)
+					std::reverse(s.begin(), s.end());
+				std::vector<GAGenome *> expected(n);
+				for (int i = 0; i < n; i++)
+				{
+					pop.individual(i).score(s[i]);
+					expected[i] = &pop.individual(i);
+				}
+				referenceSort(expected, 0, n - 1, order == GAPopulation::LOW_IS_BEST);
+				pop.sort(true);
+				for (int i = 0; i < n; i++)
+					BOOST_REQUIRE(&pop.individual(i) == expected[i]);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GAPopulation_removeWorst)
+{
+	GAResetRNG(61);
+	GA1DBinaryStringGenome genome(8);
+	const int n = 200;
+	GAPopulation one(genome, n), many(genome, n);
+	std::vector<float> s = scores(5, n);
+	for (int i = 0; i < n; i++)
+	{
+		one.individual(i).score(s[i]);
+		many.individual(i).score(s[i]);
+	}
+	one.sort(true);
+	many.sort(true);
+
+	// The same genomes come out, worst first, and the same ones are left in
+	// the same order.
+	std::vector<GAGenome *> removed(n);
+	BOOST_CHECK_EQUAL(many.removeWorst(removed.data(), 30), 30);
+	BOOST_CHECK_EQUAL(many.size(), n - 30);
+	for (int i = 0; i < 30; i++)
+	{
+		GAGenome *g = one.remove(GAPopulation::WORST);
+		BOOST_CHECK_EQUAL(g->score(), removed[i]->score());
+		delete g;
+		delete removed[i];
+	}
+	for (int i = 0; i < n - 30; i++)
+		BOOST_CHECK_EQUAL(one.individual(i).score(), many.individual(i).score());
+
+	BOOST_CHECK_EQUAL(many.removeWorst(removed.data(), 0), 0);
+	BOOST_CHECK_EQUAL(many.removeWorst(removed.data(), n), n - 30);
+	BOOST_CHECK_EQUAL(many.size(), 0);
+	for (int i = 0; i < n - 30; i++)
+		delete removed[i];
+}
+
+BOOST_AUTO_TEST_SUITE_END()
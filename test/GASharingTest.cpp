@@ -0,0 +1,277 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GABin2DecGenome.h>
+#include <GABaseGA.h>
+#include <GANeighborSearch.h>
+#include <GAPopulation.h>
+#include <GAScaling.h>
+#include <garandom.h>
+#include <gaerror.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static const int DIM = 3;
+
+using RealGenome = GA1DArrayGenome<float>;
+
+static float realObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(RealGenome &, g);
+	return 1 + genome.gene(0) * genome.gene(0);
+}
+
+static void realInitializer(GAGenome &g)
+{
+	auto &genome = STA_CAST(RealGenome &, g);
+	for (int k = 0; k < genome.length(); k++)
+		genome.gene(k, GARandomFloat(-1, 1));
+}
+
+// The distance the embedding gives, worked out the same way.
+static float realDistance(const GAGenome &a, const GAGenome &b)
+{
+	auto &x = STA_CAST(const RealGenome &, a);
+	auto &y = STA_CAST(const RealGenome &, b);
+	double sum = 0;
+	for (int k = 0; k < DIM; k++)
+	{
+		double t = STA_CAST(double, x.gene(k)) - y.gene(k);
+		sum += t * t;
+	}
+	return STA_CAST(float, std::sqrt(sum));
+}
+
+static float bitsObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 1;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+// Points in a few tight clusters, so that each one has some neighbours.
+static std::vector<float> clusters(int n, int dim, bool bits)
+{
+	std::vector<float> centre(8 * dim), x(n * dim);
+	for (float &c : centre)
+		c = bits ? GARandomBit() : GARandomFloat(-1, 1);
+	for (int i = 0; i < n; i++)
+	{
+		int c = GARandomInt(0, 7);
+		for (int k = 0; k < dim; k++)
+		{
+			float v = centre[c * dim + k];
+			if (bits)
+				x[i * dim + k] = GAFlipCoin(0.03) ? 1 - v : v;
+			else
+				x[i * dim + k] = v + GARandomFloat(-0.1, 0.1);
+		}
+	}
+	return x;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+// The index finds exactly what comparing every pair would find.
+BOOST_AUTO_TEST_CASE(GANeighborSearch_exact)
+{
+	GAResetRNG(97);
+	struct Case
+	{
+		GANeighborSearch::Metric metric;
+		int dim;
+		float radius;
+	} cases[] = {{GANeighborSearch::EUCLIDEAN, 3, 0.15f},
+				 {GANeighborSearch::MANHATTAN, 5, 0.3f},
+				 {GANeighborSearch::HAMMING, 200, 0.05f},
+				 {GANeighborSearch::HAMMING, 64, 0.3f}};
+	for (Case &c : cases)
+	{
+		const int n = 600;
+		std::vector<float> x =
+			clusters(n, c.dim, c.metric == GANeighborSearch::HAMMING);
+		GANeighborSearch index;
+		index.build(x.data(), n, c.dim, c.metric, c.radius);
+		BOOST_CHECK_EQUAL(index.size(), n);
+		GANeighborSearch::Neighbors found, expected;
+		int total = 0;
+		for (int i = 0; i < n; i++)
+		{
+			expected.clear();
+			for (int j = 0; j < n; j++)
+				if (index.distance(i, j) < c.radius)
+					expected.emplace_back(j, index.distance(i, j));
+			index.neighbors(i, c.radius, found);
+			BOOST_REQUIRE(found == expected);
+			total += found.size();
+		}
+		BOOST_CHECK_GT(total, 2 * n);
+		BOOST_CHECK_LT(total, n * n / 4);
+	}
+}
+
+// An embedding gives the same fitness as the distance function it stands for,
+// with or without threads.
+BOOST_AUTO_TEST_CASE(GASharing_embedding)
+{
+	GAResetRNG(101);
+	RealGenome real(DIM, realObjective);
+	real.initializer(realInitializer);
+	GA1DBinaryStringGenome bits(120, bitsObjective);
+
+	for (int k = 0; k < 2; k++)
+	{
+		GAPopulation pop(k == 0 ? STA_CAST(GAGenome &, real) : bits, 500);
+		pop.initialize();
+		pop.evaluate(true);
+
+		GASharing exact(k == 0 ? realDistance : GA1DBinaryStringGenome::BitComparator,
+						k == 0 ? 0.3 : 0.45, k == 0 ? 1.0 : 2.0);
+		exact.evaluate(pop);
+		std::vector<float> expected;
+		for (int i = 0; i < pop.size(); i++)
+			expected.push_back(pop.individual(i).fitness());
+
+		for (unsigned int threads : {1, 4})
+		{
+			GASharing fast(exact);
+			if (k == 0)
+				fast.embedding(RealGenome::ElementEmbedding, DIM);
+			else
+				fast.embedding(GA1DBinaryStringGenome::BitEmbedding, 120,
+							   GANeighborSearch::HAMMING);
+			fast.nThreads(threads);
+			GASharing copy(fast);
+			BOOST_CHECK(copy.embedding() == fast.embedding());
+			BOOST_CHECK_EQUAL(copy.nThreads(), threads);
+			copy.evaluate(pop);
+			for (int i = 0; i < pop.size(); i++)
+				BOOST_REQUIRE_EQUAL(pop.individual(i).fitness(), expected[i]);
+		}
+
+		// Bit strings that use the bit comparator use their bits without being
+		// asked.
+		if (k == 1)
+		{
+			GASharing plain(0.45, 2.0);
+			plain.evaluate(pop);
+			BOOST_CHECK(plain.embedding() == nullptr);
+			for (int i = 0; i < pop.size(); i++)
+				BOOST_REQUIRE_EQUAL(pop.individual(i).fitness(), expected[i]);
+		}
+
+		// The distance matrix on several threads gives the same fitness too.
+		exact.nThreads(3);
+		exact.evaluate(pop);
+		for (int i = 0; i < pop.size(); i++)
+			BOOST_REQUIRE_EQUAL(pop.individual(i).fitness(), expected[i]);
+	}
+}
+
+// The Bin2Dec genome's embedding is its phenotypes.
+BOOST_AUTO_TEST_CASE(GABin2DecGenome_embedding)
+{
+	GABin2DecPhenotype map;
+	map.add(8, -1, 1);
+	map.add(12, 0, 100);
+	GABin2DecGenome genome(map);
+	GAResetRNG(5);
+	genome.initialize();
+	float x[2];
+	GABin2DecGenome::PhenotypeEmbedding(genome, x);
+	BOOST_CHECK_EQUAL(x[0], genome.phenotype(0));
+	BOOST_CHECK_EQUAL(x[1], genome.phenotype(1));
+}
+
+static float lineDistance(const GAGenome &a, const GAGenome &b)
+{
+	auto &x = STA_CAST(const RealGenome &, a);
+	auto &y = STA_CAST(const RealGenome &, b);
+	return std::fabs(x.gene(0) - y.gene(0));
+}
+
+// Each genome keeps its score if fewer than capacity better genomes are within
+// the radius of the best of them, which is the long way of doing clearing.
+BOOST_AUTO_TEST_CASE(GAClearing_niches)
+{
+	GAResetRNG(103);
+	RealGenome genome(1, realObjective);
+	genome.initializer(realInitializer);
+	GAPopulation pop(genome, 300);
+	pop.initialize();
+	pop.evaluate(true);
+
+	for (int mm : {GAGeneticAlgorithm::MAXIMIZE, GAGeneticAlgorithm::MINIMIZE})
+	{
+		for (int capacity : {1, 3})
+		{
+			GAClearing clearing(lineDistance, 0.05, capacity);
+			clearing.minimaxi(mm);
+			GAClearing copy(clearing);
+			copy.evaluate(pop);
+
+			std::vector<int> order(pop.size());
+			for (int i = 0; i < pop.size(); i++)
+				order[i] = i;
+			std::stable_sort(order.begin(), order.end(),
+							 [&](int a, int b)
+							 {
+								 float sa = pop.individual(a).score();
+								 float sb = pop.individual(b).score();
+								 return mm == GAGeneticAlgorithm::MINIMIZE ? sa < sb
+																		   : sa > sb;
+							 });
+			float worst = pop.individual(order.back()).score();
+			std::vector<int> seeds, kept;
+			std::vector<int> sizes;
+			for (int i : order)
+			{
+				GAGenome &g = pop.individual(i);
+				std::size_t k = 0;
+				while (k < seeds.size() && lineDistance(g, pop.individual(seeds[k])) >= 0.05)
+					k++;
+				if (k == seeds.size())
+				{
+					seeds.push_back(i);
+					kept.push_back(0);
+					sizes.push_back(0);
+				}
+				sizes[k]++;
+				BOOST_REQUIRE_EQUAL(copy.niche(g), STA_CAST(int, k));
+				if (kept[k]++ < capacity)
+					BOOST_REQUIRE_EQUAL(g.fitness(), g.score());
+				else
+					BOOST_REQUIRE_EQUAL(g.fitness(), worst);
+			}
+			BOOST_CHECK_EQUAL(copy.nNiches(), STA_CAST(int, seeds.size()));
+			BOOST_CHECK_GT(copy.nNiches(), 20);
+			BOOST_CHECK_LE(copy.nNiches(), 41); // the seeds are at least 0.05 apart
+			for (int k = 0; k < copy.nNiches(); k++)
+			{
+				BOOST_CHECK(&copy.seed(k) == &pop.individual(seeds[k]));
+				BOOST_CHECK_EQUAL(copy.nicheSize(k), sizes[k]);
+			}
+
+			// A copy of an evaluated scheme does not keep its niches.
+			GAClearing again(copy);
+			BOOST_CHECK_EQUAL(again.nNiches(), 0);
+			BOOST_CHECK_EQUAL(again.niche(pop.individual(seeds[0])), -1);
+		}
+	}
+
+	GAClearing clearing;
+	BOOST_CHECK_EQUAL(clearing.niche(genome), -1);
+	GAReportErrors(false);
+	BOOST_CHECK_EQUAL(clearing.radius(0), gaDefClearingRadius);
+	BOOST_CHECK_EQUAL(clearing.capacity(0), gaDefClearingCapacity);
+	GAReportErrors(true);
+	BOOST_CHECK_EQUAL(clearing.radius(0.2), 0.2f);
+	BOOST_CHECK_EQUAL(clearing.capacity(2), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GASimpleGA.h>
+#include <GAStaticGA.hpp>
+
+#include <algorithm>
+#include <vector>
+
+static float objectiveStaticOnes(GAGenome &g)
+{
+	auto &genome = static_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+class StaticOnes
+{
+  public:
+	static float evaluate(GA1DBinaryStringGenome &g)
+	{
+		return objectiveStaticOnes(g);
+	}
+};
+
+// Number of elements that are not in their place.
+class StaticSorted
+{
+  public:
+	static float evaluate(GA1DArrayGenome<int> &g)
+	{
+		float score = 0.0;
+		for (int i = 0; i < g.length(); i++)
+		{
+			score += (g.gene(i) != i) ? 1 : 0;
+		}
+		return score;
+	}
+};
+
+static void initializerShuffle(GAGenome &g)
+{
+	auto &genome = static_cast<GA1DArrayGenome<int> &>(g);
+	for (int i = 0; i < genome.length(); i++)
+	{
+		genome.gene(i, i);
+	}
+	for (int i = genome.length() - 1; i > 0; i--)
+	{
+		genome.swap(i, GARandomInt(0, i));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+// With the population selector and the library operators the static engine
+// must produce exactly the same runs as GASimpleGA.
+BOOST_AUTO_TEST_CASE(GAStaticGA_same_as_simple)
+{
+	using StaticGA = GAStaticGA<
+		GA1DBinaryStringGenome, GAStaticObjectiveFunction<objectiveStaticOnes>,
+		GAStaticSexualCrossover<GA1DBinaryStringGenome::UniformCrossover>,
+		GAStaticMutatorFunction<GA1DBinaryStringGenome::FlipMutator>>;
+
+	GA1DBinaryStringGenome genome(64, objectiveStaticOnes);
+	genome.crossover(GA1DBinaryStringGenome::UniformCrossover);
+	genome.mutator(GA1DBinaryStringGenome::FlipMutator);
+
+	GASimpleGA simple(genome);
+	StaticGA fast(genome);
+	BOOST_CHECK_EQUAL(fast.className(), "GAStaticGA");
+	for (GASimpleGA *ga : {&simple, static_cast<GASimpleGA *>(&fast)})
+	{
+		ga->populationSize(31);
+		ga->pMutation(0.01);
+		ga->pCrossover(0.8);
+	}
+
+	GAResetRNG(7);
+	simple.initialize();
+	std::vector<float> best;
+	for (int i = 0; i < 30; i++)
+	{
+		simple.step();
+		best.push_back(simple.population().best().score());
+	}
+
+	GAResetRNG(7);
+	fast.initialize();
+	for (int i = 0; i < 30; i++)
+	{
+		fast.step();
+		BOOST_CHECK_EQUAL(fast.population().best().score(), best[i]);
+	}
+
+	const GAStatistics &a = simple.statistics();
+	const GAStatistics &b = fast.statistics();
+	BOOST_CHECK_EQUAL(a.generation(), b.generation());
+	BOOST_CHECK_EQUAL(a.selections(), b.selections());
+	BOOST_CHECK_EQUAL(a.crossovers(), b.crossovers());
+	BOOST_CHECK_EQUAL(a.mutations(), b.mutations());
+	BOOST_CHECK_EQUAL(a.indEvals(), b.indEvals());
+	BOOST_CHECK_EQUAL(a.maxEver(), b.maxEver());
+	BOOST_CHECK(a.bestIndividual() == b.bestIndividual());
+}
+
+BOOST_AUTO_TEST_CASE(GAStaticGA_onemax)
+{
+	GAStaticGA<GA1DBinaryStringGenome, StaticOnes,
+			   GAStaticUniformCrossover<GA1DBinaryStringGenome>,
+			   GAStaticFlipMutator<GA1DBinaryStringGenome>,
+			   GAStaticTournamentSelector>
+		ga(GA1DBinaryStringGenome(32, objectiveStaticOnes));
+	ga.populationSize(50);
+	ga.nGenerations(100);
+	ga.pMutation(0.01);
+	ga.evolve(1);
+
+	BOOST_CHECK_EQUAL(ga.statistics().maxEver(), 32.0);
+	BOOST_CHECK_EQUAL(ga.statistics().generation(), 100);
+
+	// The policies are installed in the genomes as well.
+	GAGenome &g = ga.population().individual(0);
+	BOOST_CHECK(g.evaluator() == decltype(ga)::Evaluator);
+	g.initialize();
+	BOOST_CHECK_EQUAL(g.score(), objectiveStaticOnes(g));
+}
+
+BOOST_AUTO_TEST_CASE(GAStaticGA_permutation)
+{
+	GA1DArrayGenome<int> genome(20);
+	genome.initializer(initializerShuffle);
+
+	GAStaticGA<GA1DArrayGenome<int>, StaticSorted,
+			   GAStaticSexualCrossover<GA1DArrayGenome<int>::PartialMatchCrossover>,
+			   GAStaticSwapMutator<GA1DArrayGenome<int>>,
+			   GAStaticTournamentSelector>
+		ga(genome);
+	ga.minimize();
+	ga.populationSize(40);
+	ga.nGenerations(50);
+	ga.pMutation(0.05);
+	ga.evolve(1);
+
+	// The operators keep the genomes permutations.
+	const auto &best =
+		static_cast<const GA1DArrayGenome<int> &>(ga.statistics().bestIndividual());
+	std::vector<int> seen(best.length(), 0);
+	for (int i = 0; i < best.length(); i++)
+	{
+		seen[best.gene(i)]++;
+	}
+	BOOST_CHECK(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+	BOOST_CHECK_LT(ga.statistics().minEver(), 20.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GA1DBinStrGenome.h>
+#include <GASStateGA.h>
+#include <GASimpleGA.h>
+
+#include <sstream>
+#include <string>
+
+static float objectiveOnes(GAGenome &g)
+{
+	auto &genome = dynamic_cast<GA1DBinaryStringGenome &>(g);
+	float score = 0.0;
+	for (int i = 0; i < genome.length(); i++)
+	{
+		score += genome.gene(i);
+	}
+	return score;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GAStatistics_timing_off)
+{
+	GA1DBinaryStringGenome genome(32, objectiveOnes);
+	GASimpleGA ga(genome);
+	ga.populationSize(20);
+	ga.nGenerations(5);
+	BOOST_CHECK(!ga.recordTiming());
+	ga.evolve(1);
+
+	BOOST_CHECK_EQUAL(ga.statistics().totalTime(), 0.0);
+	BOOST_CHECK(GAStatistics::timer() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GAStatistics_timing_simple)
+{
+	GA1DBinaryStringGenome genome(256, objectiveOnes);
+	GASimpleGA ga(genome);
+	ga.populationSize(50);
+	ga.nGenerations(20);
+	ga.recordTiming(true);
+	ga.evolve(1);
+
+	const GAStatistics &stats = ga.statistics();
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Selection), 0.0);
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Crossover), 0.0);
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Mutation), 0.0);
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Evaluation), 0.0);
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Statistics), 0.0);
+	BOOST_CHECK_GT(stats.generationTime(), 0.0);
+	BOOST_CHECK_GE(stats.totalTime(), stats.generationTime());
+	BOOST_CHECK(GAStatistics::timer() == nullptr);
+
+	std::stringstream str;
+	stats.timings(str);
+	std::string line;
+	int nlines = 0;
+	while (std::getline(str, line))
+	{
+		nlines++;
+	}
+	BOOST_CHECK_EQUAL(nlines, GAStatistics::NumPhases + 2);
+}
+
+BOOST_AUTO_TEST_CASE(GAStatistics_timing_parameter)
+{
+	GA1DBinaryStringGenome genome(64, objectiveOnes);
+	GASteadyStateGA ga(genome);
+	ga.set(gaNrecordTiming, 1);
+	BOOST_CHECK(ga.recordTiming());
+	ga.nGenerations(10);
+	ga.evolve(1);
+
+	const GAStatistics &stats = ga.statistics();
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Replacement), 0.0);
+	BOOST_CHECK_GT(stats.totalPhaseTime(GAStatistics::Phase::Sorting), 0.0);
+	BOOST_CHECK_EQUAL(
+		std::string(GAStatistics::phaseName(GAStatistics::Phase::Sorting)),
+		"sorting");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
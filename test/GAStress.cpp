@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------------
+  GAStress.cpp
+
+ DESCRIPTION:
+   Concurrency stress test.  This runs a batch of small, independent genetic
+algorithms (each of the genetic algorithms on list, allele, binary-to-decimal
+and bit string genomes) one after the other, then runs the same batch again on
+several threads at once and checks that every run got exactly the same answer
+as it did on its own.  Build it with GALIB_TSAN to have ThreadSanitizer look
+for data races while it runs.
+
+   Usage:  GAlibStress [threads n] [jobs n] [generations n]
+
+   It returns 0 if every run matched and 1 if any did not.
+---------------------------------------------------------------------------- */
+#include <GA1DArrayGenome.hpp>
+#include <GA1DBinStrGenome.h>
+#include <GABin2DecGenome.h>
+#include <GADCrowdingGA.h>
+#include <GADemeGA.h>
+#include <GAIncGA.h>
+#include <GAListGenome.hpp>
+#include <GASStateGA.h>
+#include <GAScaling.h>
+#include <GASimpleGA.h>
+#include <garandom.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// The genomes that every run starts from.  The runs copy them, so the copies
+// share these (and the phenotype and allele cores of these) across threads.
+static GABin2DecPhenotype *stressPhenotype;
+static GAAlleleSet<int> *stressAlleles;
+
+static const int NKINDS = 6;
+
+static float onesObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DBinaryStringGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += genome.gene(i);
+	return score;
+}
+
+static float sphereObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GABin2DecGenome &, g);
+	float score = 0;
+	for (int i = 0; i < genome.nPhenotypes(); i++)
+		score += genome.phenotype(i) * genome.phenotype(i);
+	return score;
+}
+
+// The number of neighbours in the list that are in order.
+static float orderObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GAListGenome<int> &, g);
+	float score = 0;
+	for (int i = 1; i < genome.size(); i++)
+		if (*genome.warp(i - 1) < *genome.warp(i))
+			score += 1;
+	return score;
+}
+
+static void orderInitializer(GAGenome &g)
+{
+	auto &genome = STA_CAST(GAListGenome<int> &, g);
+	while (genome.head())
+		genome.destroy();
+	for (int i = 0; i < 20; i++)
+		genome.insert(i, GAListBASE::TAIL);
+	for (int i = 0; i < 20; i++)
+		genome.swap(i, GARandomInt(0, 19));
+}
+
+static float alleleObjective(GAGenome &g)
+{
+	auto &genome = STA_CAST(GA1DArrayAlleleGenome<int> &, g);
+	float score = 0;
+	for (int i = 0; i < genome.length(); i++)
+		score += (genome.gene(i) == i % 5) ? 1 : 0;
+	return score;
+}
+
+struct StressResult
+{
+	float best, online, offline;
+	bool operator==(const StressResult &r) const
+	{
+		return best == r.best && online == r.online && offline == r.offline;
+	}
+};
+
+static StressResult evolve(GAGeneticAlgorithm &ga, int ngen)
+{
+	ga.nGenerations(ngen);
+	ga.pMutation(0.02);
+	ga.pCrossover(0.9);
+	ga.evolve();
+	const GAStatistics &stats = ga.statistics();
+	return {stats.bestIndividual().score(), stats.online(), stats.offlineMax()};
+}
+
+// Run job number 'job'.  Which GA and genome it uses depends on the job, the
+// seed depends only on the job so that the run is the same on any thread.  We
+// seed before we make the GA since setting one up can use random numbers too
+// (a population that grows copies members picked at random).
+static StressResult runJob(int job, int ngen)
+{
+	GAResetRNG(1000 + job);
+	switch (job % NKINDS)
+	{
+	case 0:
+	{
+		GA1DBinaryStringGenome genome(64, onesObjective);
+		GASimpleGA ga(genome);
+		ga.populationSize(30);
+		ga.elitist(true);
+		ga.scaling(GASigmaTruncationScaling());
+		return evolve(ga, ngen);
+	}
+	case 1:
+	{
+		GABin2DecGenome genome(*stressPhenotype, sphereObjective);
+		GASteadyStateGA ga(genome);
+		ga.minimize();
+		ga.populationSize(30);
+		ga.pReplacement(0.5);
+		return evolve(ga, ngen);
+	}
+	case 2:
+	{
+		GAListGenome<int> genome(orderObjective);
+		genome.initializer(orderInitializer);
+		genome.crossover(GAListGenome<int>::OrderCrossover);
+		GAIncrementalGA ga(genome);
+		ga.populationSize(30);
+		return evolve(ga, ngen * 10);
+	}
+	case 3:
+	{
+		GA1DBinaryStringGenome genome(48, onesObjective);
+		GADemeGA ga(genome);
+		ga.nPopulations(3);
+		ga.populationSize(12);
+		return evolve(ga, ngen);
+	}
+	case 4:
+	{
+		GA1DBinaryStringGenome genome(48, onesObjective);
+		GADCrowdingGA ga(genome);
+		ga.nThreads(2);
+		ga.populationSize(30);
+		return evolve(ga, ngen);
+	}
+	default:
+	{
+		GA1DArrayAlleleGenome<int> genome(25, *stressAlleles, alleleObjective);
+		GASimpleGA ga(genome);
+		ga.populationSize(30);
+		ga.selector(GATournamentSelector());
+		return evolve(ga, ngen);
+	}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int nthreads = 8, njobs = 48, ngen = 30;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (strcmp("threads", argv[i]) == 0)
+			nthreads = atoi(argv[i + 1]);
+		else if (strcmp("jobs", argv[i]) == 0)
+			njobs = atoi(argv[i + 1]);
+		else if (strcmp("generations", argv[i]) == 0)
+			ngen = atoi(argv[i + 1]);
+		else
+		{
+			std::cerr << argv[0] << ": unrecognized argument: " << argv[i] << "\n";
+			exit(1);
+		}
+	}
+
+	GABin2DecPhenotype phenotype;
+	for (int i = 0; i < 4; i++)
+		phenotype.add(12, -5.0, 5.0);
+	int values[] = {0, 1, 2, 3, 4};
+	GAAlleleSet<int> alleles(5, values);
+	stressPhenotype = &phenotype;
+	stressAlleles = &alleles;
+
+	std::vector<StressResult> expected(njobs), found(njobs);
+	for (int j = 0; j < njobs; j++)
+		expected[j] = runJob(j, ngen);
+
+	std::atomic<int> next(0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < nthreads; t++)
+	{
+		threads.emplace_back(
+			[&]
+			{
+				for (int j = next++; j < njobs; j = next++)
+					found[j] = runJob(j, ngen);
+			});
+	}
+	for (std::thread &t : threads)
+		t.join();
+
+	int nbad = 0;
+	for (int j = 0; j < njobs; j++)
+	{
+		if (!(found[j] == expected[j]))
+		{
+			std::cerr << "job " << j << ": best " << found[j].best << " online "
+					  << found[j].online << " offline " << found[j].offline
+					  << " in parallel, but best " << expected[j].best
+					  << " online " << expected[j].online << " offline "
+					  << expected[j].offline << " in series\n";
+			nbad++;
+		}
+	}
+	std::cout << njobs << " runs on " << nthreads << " threads, " << nbad
+			  << " different\n";
+	return nbad == 0 ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+#include <boost/test/unit_test.hpp>
+
+#include <GATreeGenome.hpp>
+#include <garandom.h>
+
+extern GANodeBASE *_GATreeTraverse(unsigned int, unsigned int &, GANodeBASE *);
+
+// Build a random tree with n nodes, each node gets its creation number.
+static void buildTree(GATree<int> &tree, int n)
+{
+	tree.insert(0, GATreeBASE::ROOT);
+	for (int i = 1; i < n; i++)
+	{
+		tree.warp(GARandomInt(0, i - 1));
+		tree.insert(i, GATreeBASE::BELOW);
+	}
+	tree.root();
+}
+
+// The indexed lookup must find the same node as a depth-first traversal.
+static bool sameOrder(GATree<int> &tree)
+{
+	GATreeIter<int> iter(tree);
+	iter.root();
+	GANodeBASE *root = iter.GATreeIterBASE::current();
+	for (int i = 0; i < tree.size(); i++)
+	{
+		unsigned int w = 0;
+		GANodeBASE *expected = _GATreeTraverse(i, w, root);
+		if (iter.warp(i) == nullptr || iter.GATreeIterBASE::current() != expected)
+		{
+			return false;
+		}
+	}
+	return iter.warp(tree.size()) == nullptr;
+}
+
+BOOST_AUTO_TEST_SUITE(UnitTest)
+
+BOOST_AUTO_TEST_CASE(GATree_warp)
+{
+	GAResetRNG(5);
+	GATree<int> tree;
+	buildTree(tree, 200);
+	BOOST_CHECK_EQUAL(tree.size(), 200);
+	BOOST_CHECK(sameOrder(tree));
+	BOOST_CHECK_EQUAL(*tree.warp(0), 0);
+
+	// Swapping nodes keeps the shape, so the list of nodes is patched up.
+	for (int i = 0; i < 50; i++)
+	{
+		tree.swap(GARandomInt(0, 199), GARandomInt(0, 199));
+	}
+	BOOST_CHECK(sameOrder(tree));
+
+	// Swapping subtrees, destroying and copying change the shape.
+	for (int i = 0; i < 20; i++)
+	{
+		int a = GARandomInt(0, tree.size() - 1);
+		int b = GARandomInt(0, tree.size() - 1);
+		if (!tree.ancestral(a, b))
+		{
+			tree.swaptree(a, b);
+		}
+	}
+	BOOST_CHECK_EQUAL(tree.size(), 200);
+	BOOST_CHECK(sameOrder(tree));
+
+	tree.warp(7);
+	tree.destroy();
+	BOOST_CHECK_LT(tree.size(), 200);
+	BOOST_CHECK(sameOrder(tree));
+
+	GATree<int> copy(tree);
+	BOOST_CHECK_EQUAL(copy.size(), tree.size());
+	BOOST_CHECK(sameOrder(copy));
+	for (int i = 0; i < tree.size(); i++)
+	{
+		BOOST_CHECK_EQUAL(*copy.warp(i), *tree.warp(i));
+	}
+
+	GATree<int> *part = tree.clone(3);
+	BOOST_CHECK(sameOrder(*part));
+	BOOST_CHECK_EQUAL(*part->root(), *tree.warp(3));
+	delete part;
+}
+
+BOOST_AUTO_TEST_CASE(GATreeGenome_mutators)
+{
+	GAResetRNG(9);
+	GATreeGenome<int> genome;
+	buildTree(genome, 2000);
+
+	GATreeGenome<int>::SwapNodeMutator(genome, 0.05);
+	BOOST_CHECK_EQUAL(genome.size(), 2000);
+	BOOST_CHECK(sameOrder(genome));
+
+	GATreeGenome<int>::DestructiveMutator(genome, 0.002);
+	BOOST_CHECK(sameOrder(genome));
+
+	GATreeGenome<int> other(genome), sis(genome), bro(genome);
+	GATreeGenome<int>::SwapSubtreeMutator(other, 0.01);
+	GATreeGenome<int>::OnePointCrossover(genome, other, &sis, &bro);
+	BOOST_CHECK(sameOrder(sis));
+	BOOST_CHECK(sameOrder(bro));
+	BOOST_CHECK_EQUAL(sis.size() + bro.size(), genome.size() + other.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()